@@ -17,6 +17,9 @@
  */
 
 #include "lib/charset/ob_ctype.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 static void __attribute__ ((noinline)) pad_max_char_help(char *str, char *end, char *buf, char buf_len)
 {
@@ -491,6 +494,26 @@ int __attribute__ ((noinline))  ob_strnncollsp_mb_bin_help(
   return 0;
 }
 
+// length of the common prefix of a and b, scanned 16 bytes at a time.
+static inline size_t ob_common_prefix_len(const unsigned char *a, const unsigned char *b, size_t len)
+{
+  size_t pos = 0;
+#if defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16) {
+    const int eq_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + pos)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + pos))));
+    if (0xFFFF != eq_mask) {
+      return pos + __builtin_ctz(~eq_mask & 0xFFFF);
+    }
+  }
+#endif
+  while (pos < len && a[pos] == b[pos]) {
+    ++pos;
+  }
+  return pos;
+}
+
 int ob_strnncollsp_mb_bin(const ObCharsetInfo *cs __attribute__((unused)),
                       const unsigned char *a, size_t a_length,
                       const unsigned char *b, size_t b_length,
@@ -501,6 +524,9 @@ int ob_strnncollsp_mb_bin(const ObCharsetInfo *cs __attribute__((unused)),
   int res;
 
   end= a + (length= OB_MIN(a_length, b_length));
+  const size_t prefix_len = ob_common_prefix_len(a, b, length);
+  a += prefix_len;
+  b += prefix_len;
   while (a < end) {
     if (*a++ != *b++) {
       return ((int) a[-1] - (int) b[-1]);
@@ -23,6 +23,9 @@
 #include "lib/charset/ob_dtoa.h"
 #include "lib/charset/ob_uctype.h"
 #include "lib/utility/ob_macro_utils.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 
 #define IS_CONTINUATION_BYTE(code) (((code) >> 6) == 0x02)
@@ -1814,6 +1817,66 @@ static inline void ob_tosort_unicode(ObUnicaseInfo *uni_plane, ob_wc_t *wc, unsi
   }
 }
 
+// ASCII characters are single bytes in utf8mb4 and their weights in general_ci are
+// case folded bytes, so a run of ASCII characters can be compared and hashed
+// without decoding. The helpers below scan 16 bytes at a time with SSE2.
+
+// length of the common prefix of src and dst in which all characters are ASCII
+// and equal ignoring case, the prefix always ends at a character boundary.
+static inline size_t ob_ascii_caseeq_prefix_len(const unsigned char *src,
+                                                const unsigned char *dst, size_t len)
+{
+  size_t pos = 0;
+#if defined(__SSE2__)
+  const __m128i lower_beg = _mm_set1_epi8('a' - 1);
+  const __m128i lower_end = _mm_set1_epi8('z' + 1);
+  const __m128i case_bit = _mm_set1_epi8(0x20);
+  for (; pos + 16 <= len; pos += 16) {
+    const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + pos));
+    const __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + pos));
+    // non ASCII bytes are negative as signed char and never in ['a', 'z']
+    const __m128i s_lower = _mm_and_si128(_mm_cmpgt_epi8(s, lower_beg), _mm_cmplt_epi8(s, lower_end));
+    const __m128i t_lower = _mm_and_si128(_mm_cmpgt_epi8(t, lower_beg), _mm_cmplt_epi8(t, lower_end));
+    const __m128i s_upper = _mm_sub_epi8(s, _mm_and_si128(s_lower, case_bit));
+    const __m128i t_upper = _mm_sub_epi8(t, _mm_and_si128(t_lower, case_bit));
+    const int eq_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(s_upper, t_upper));
+    const int non_ascii_mask = _mm_movemask_epi8(_mm_or_si128(s, t));
+    const int stop_mask = (~eq_mask | non_ascii_mask) & 0xFFFF;
+    if (0 != stop_mask) {
+      return pos + __builtin_ctz(stop_mask);
+    }
+  }
+#endif
+  for (; pos < len; ++pos) {
+    const unsigned char s = src[pos];
+    const unsigned char t = dst[pos];
+    if (s >= 0x80 || t >= 0x80
+        || (s != t && ((s | 0x20) != (t | 0x20) || (s | 0x20) < 'a' || (s | 0x20) > 'z'))) {
+      break;
+    }
+  }
+  return pos;
+}
+
+// length of the prefix of str in which all characters are ASCII.
+static inline size_t ob_ascii_prefix_len(const unsigned char *str, size_t len)
+{
+  size_t pos = 0;
+#if defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16) {
+    const int non_ascii_mask = _mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + pos)));
+    if (0 != non_ascii_mask) {
+      return pos + __builtin_ctz(non_ascii_mask);
+    }
+  }
+#endif
+  while (pos < len && str[pos] < 0x80) {
+    ++pos;
+  }
+  return pos;
+}
+
 static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
                      const unsigned char *src, size_t srclen,
                      const unsigned char *dst, size_t dstlen,
@@ -1824,6 +1887,12 @@ static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
   const unsigned char *te = dst + dstlen;
   ObUnicaseInfo *uni_plane = cs->caseinfo;
   while ( src < se && dst < te ) {
+    const size_t ascii_len = ob_ascii_caseeq_prefix_len(src, dst, OB_MIN(se - src, te - dst));
+    src += ascii_len;
+    dst += ascii_len;
+    if (src >= se || dst >= te) {
+      break;
+    }
     int s_res = ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
     int t_res = ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
     if ( s_res <= 0 || t_res <= 0 ) {
@@ -1894,6 +1963,12 @@ static int ob_strnncollsp_utf8mb4(const ObCharsetInfo *cs,
   const unsigned char *se= src + srclen, *te= dst + dstlen;
   ObUnicaseInfo *uni_plane= cs->caseinfo;
   while ( src < se && dst < te ) {
+    const size_t ascii_len = ob_ascii_caseeq_prefix_len(src, dst, OB_MIN(se - src, te - dst));
+    src += ascii_len;
+    dst += ascii_len;
+    if (src >= se || dst >= te) {
+      break;
+    }
     int s_res= ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
     int t_res= ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
     if ( s_res <= 0 || t_res <= 0 ) {
@@ -2222,8 +2297,23 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *s
       end--;
   }
 
+  // weights of ASCII characters, same as ob_tosort_unicode() on them
+  const ObUnicaseInfoChar *ascii_page = uni_plane->maxchar >= 0x7F ? uni_plane->page[0] : NULL;
+  const bool lower_sort = (cs->state & OB_CS_LOWER_SORT);
+
   if (NULL == hash_algo) {
-    while ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) > 0) {
+    while (src < end) {
+      if (NULL != ascii_page) {
+        const unsigned char *ascii_end = src + ob_ascii_prefix_len(src, end - src);
+        for (; src < ascii_end; ++src) {
+          wc = lower_sort ? ascii_page[*src].tolower : ascii_page[*src].sort;
+          ob_hash_add(n1, n2, (unsigned int) (wc & 0xFF));
+          ob_hash_add(n1, n2, (unsigned int) (wc >> 8)  & 0xFF);
+        }
+      }
+      if ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) <= 0) {
+        break;
+      }
       ob_tosort_unicode(uni_plane, &wc, cs->state);
       ob_hash_add(n1, n2, (unsigned int) (wc & 0xFF));
       ob_hash_add(n1, n2, (unsigned int) (wc >> 8)  & 0xFF);
@@ -2233,7 +2323,22 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *s
       src+= res;
     }
   } else {
-    while ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) > 0) {
+    while (src < end) {
+      if (NULL != ascii_page) {
+        const unsigned char *ascii_end = src + ob_ascii_prefix_len(src, end - src);
+        for (; src < ascii_end; ++src) {
+          wc = lower_sort ? ascii_page[*src].tolower : ascii_page[*src].sort;
+          if (length > HASH_BUFFER_LENGTH - 2) {
+            *n1 = hash_algo((void*) &data, length, *n1);
+            length = 0;
+          }
+          data[length++] = (unsigned char)wc;
+          data[length++] = (unsigned char)(wc >> 8);
+        }
+      }
+      if ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) <= 0) {
+        break;
+      }
       ob_tosort_unicode(uni_plane, &wc, cs->state);
       if (length > HASH_BUFFER_LENGTH - 2 || (HASH_BUFFER_LENGTH - 2 == length && wc > 0xFFFF)) {
         *n1 = hash_algo((void*) &data, length, *n1);
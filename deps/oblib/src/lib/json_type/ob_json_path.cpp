@@ -365,7 +365,12 @@ bool ObJsonPathCache::is_match(ObString& path_str, size_t idx)
   if (idx < size()) {
     ObJsonPath* path = path_at(idx);
     if (OB_NOT_NULL(path)) {
-      result = ObJsonPathUtil::string_cmp_skip_charactor(path_str, path->get_path_string(), ' ') == 0;
+      ObString &cache_str = path->get_path_string();
+      // path text of a constant argument is the same for every row, try a plain
+      // byte compare before the compare skipping spaces.
+      result = (cache_str.length() == path_str.length()
+                && 0 == MEMCMP(cache_str.ptr(), path_str.ptr(), path_str.length()))
+               || ObJsonPathUtil::string_cmp_skip_charactor(path_str, cache_str, ' ') == 0;
     }
   }
   return result;
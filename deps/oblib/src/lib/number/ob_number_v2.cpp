@@ -4597,17 +4597,46 @@ int ObNumber::add_v2_(const ObNumber &other, ObNumber &value, IAllocator &alloca
   return ret;
 }
 
+int ObNumber::fast_scaled_add_sub_v3_(const ObNumber &other, const bool is_minus, ObNumber &value,
+                                      ObIAllocator &allocator, bool &is_done) const
+{
+  int ret = OB_SUCCESS;
+  uint32_t tmp_digits[3];
+  Desc res_desc;
+  is_done = false;
+  if (try_fast_scaled_add_sub(*this, other, is_minus, tmp_digits, res_desc)) {
+    uint32_t *digit_mem = NULL;
+    if (0 == res_desc.len_) {
+      value.set_zero();
+      is_done = true;
+    } else if (OB_ISNULL(digit_mem = (uint32_t *)allocator.alloc(sizeof(uint32_t) * res_desc.len_))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("failed to alloc mem", "size", sizeof(uint32_t) * res_desc.len_, K(ret));
+    } else {
+      MEMCPY(digit_mem, tmp_digits, sizeof(uint32_t) * res_desc.len_);
+      value.assign(res_desc.desc_, digit_mem);
+      is_done = true;
+    }
+  }
+  return ret;
+}
+
 int ObNumber::add_v3(const ObNumber &other, ObNumber &value, ObIAllocator &allocator,
                      const bool strict_mode/*true*/, const bool do_rounding/*true*/) const
 {
   int ret = OB_SUCCESS;
   ObNumber res;
   const bool use_oracle_mode = is_oracle_mode();
+  bool is_done = false;
   LOG_DEBUG("add_v3", K(ret), KPC(this), K(other));
   if (OB_UNLIKELY(is_zero())) {
     ret = res.deep_copy_v3(other, allocator);
   } else if (OB_UNLIKELY(other.is_zero())) {
     ret = res.deep_copy_v3(*this, allocator);
+  } else if (OB_FAIL(fast_scaled_add_sub_v3_(other, false, res, allocator, is_done))) {
+    LOG_WARN("fast scaled add failed", K(ret));
+  } else if (is_done) {
+    // fixed-width fast path done
   } else if (d_.sign_ == other.d_.sign_) {
     const int64_t this_exp = get_decode_exp(d_);
     const int64_t other_exp = get_decode_exp(other.d_);
@@ -4859,11 +4888,16 @@ int ObNumber::sub_v3(const ObNumber &other, ObNumber &value, ObIAllocator &alloc
   int ret = OB_SUCCESS;
   ObNumber res;
   const bool use_oracle_mode = is_oracle_mode();
+  bool is_done = false;
   LOG_DEBUG("sub_v3", K(ret), KPC(this), K(other));
   if (OB_UNLIKELY(is_zero())) {
     ret = other.negate_v3_(res, allocator);
   } else if (OB_UNLIKELY(other.is_zero())) {
     ret = res.deep_copy_v3(*this, allocator);
+  } else if (OB_FAIL(fast_scaled_add_sub_v3_(other, true, res, allocator, is_done))) {
+    LOG_WARN("fast scaled sub failed", K(ret));
+  } else if (is_done) {
+    // fixed-width fast path done
   } else if (d_.sign_ == other.d_.sign_) {
     const int64_t this_exp = get_decode_exp(d_);
     const int64_t other_exp = get_decode_exp(other.d_);
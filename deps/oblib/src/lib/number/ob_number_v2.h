@@ -549,6 +549,16 @@ public:
   //  - b range: 0.[000000001, 999999999]
   OB_INLINE static bool try_fast_minus(ObNumber &l_num, ObNumber &r_num,
                                      uint32_t *res_digit, Desc &res_desc);
+  // fixed-width add/minus fast path for numbers with at most 9 integer digits and
+  // 9 fractional digits (e.g. DECIMAL(18, 2)), both signs. Such a number is a
+  // scaled int64 (value * BASE), so the result can be computed by one int64 add/minus.
+  //  - a range: [-999999999.999999999, 999999999.999999999]
+  //  - b range: [-999999999.999999999, 999999999.999999999]
+  OB_INLINE static bool try_fast_scaled_add_sub(const ObNumber &l_num, const ObNumber &r_num,
+                                                const bool is_minus,
+                                                uint32_t *res_digit, Desc &res_desc);
+  OB_INLINE static bool get_scaled_int64(const ObNumber &num, int64_t &value);
+  OB_INLINE static void from_scaled_int64(const int64_t value, uint32_t *res_digit, Desc &res_desc);
 
 
 
@@ -616,6 +626,8 @@ protected:
   int negate_(ObNumber &value, IAllocator &allocator) const;
   int negate_v2_(ObNumber &value, IAllocator &allocator) const;//without check
   int negate_v3_(ObNumber &value, ObIAllocator &allocator) const;//without check
+  int fast_scaled_add_sub_v3_(const ObNumber &other, const bool is_minus, ObNumber &value,
+                              ObIAllocator &allocator, bool &is_done) const;
   int sqrt_first_guess_(ObNumber &value, ObIAllocator &allocator) const;
   bool is_integer(int32_t &expr_value) const;
   static int32_t get_decode_exp(const ObNumber::Desc &desc) __attribute__((always_inline));
@@ -3495,6 +3507,8 @@ OB_INLINE bool ObNumber::try_fast_add(ObNumber &l_num, ObNumber &r_num,
     }
     res_desc.sign_ = POSITIVE;
     res_desc.reserved_ = 0; // must assign 0 explicitly here, due to optimization in sql, https://work.aone.alibaba-inc.com/issue/40852179.
+  } else {
+    is_fast_panel = try_fast_scaled_add_sub(l_num, r_num, false, res_digit, res_desc);
   }
 
   return is_fast_panel;
@@ -3508,9 +3522,8 @@ OB_INLINE bool ObNumber::try_fast_minus(ObNumber &l_num, ObNumber &r_num,
   uint64_t res_int_val = 0;
   uint64_t carry = BASE;
 
-  // TODO qubin.qb: support more sophisticated cases in further release.
-  // E.G: minus between positive integer(2 - 1) or  postive decimal(e.g: 1.32 - 1.1).
-  // So far only support cases like 2 - 0.3
+  // cases like 2 - 0.3 are handled here, other fixed-width cases
+  // (e.g: 2 - 1, 1.32 - 1.1, -1.5 - 2.25) go to the scaled int64 path below.
   if (l_num.d_.is_1d_positive_integer() && r_num.d_.is_1d_positive_fragment()) {
     is_fast_panel = true;
     res_int_val = l_num.get_digits()[0] - 1;
@@ -3529,6 +3542,79 @@ OB_INLINE bool ObNumber::try_fast_minus(ObNumber &l_num, ObNumber &r_num,
     }
     res_desc.len_ -= (res_frag_val == 0);
     res_desc.reserved_ = 0;
+  } else {
+    is_fast_panel = try_fast_scaled_add_sub(l_num, r_num, true, res_digit, res_desc);
+  }
+  return is_fast_panel;
+}
+
+OB_INLINE bool ObNumber::get_scaled_int64(const ObNumber &num, int64_t &value)
+{
+  bool is_fast_panel = true;
+  const Desc &desc = num.d_;
+  value = 0;
+  if (0 == desc.len_) {
+    // zero
+  } else {
+    const int64_t exp = get_decode_exp(desc.desc_);
+    if (0 == exp && desc.len_ <= 2) {
+      value = static_cast<int64_t>(num.digits_[0]) * BASE + (2 == desc.len_ ? num.digits_[1] : 0);
+    } else if (-1 == exp && 1 == desc.len_) {
+      value = num.digits_[0];
+    } else {
+      is_fast_panel = false;
+    }
+    if (NEGATIVE == desc.sign_) {
+      value = -value;
+    }
+  }
+  return is_fast_panel;
+}
+
+OB_INLINE void ObNumber::from_scaled_int64(const int64_t value, uint32_t *res_digit, Desc &res_desc)
+{
+  // |value| < 2 * BASE * BASE, the result has 3 digits at most: [hi, lo] . [frag]
+  const uint64_t abs_val = value < 0 ? -static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+  const uint64_t int_val = abs_val / BASE;
+  const uint32_t tmp_digit[3] = { static_cast<uint32_t>(int_val / BASE),
+                                  static_cast<uint32_t>(int_val % BASE),
+                                  static_cast<uint32_t>(abs_val % BASE) };
+  int64_t start = 0;
+  int64_t end = 3;
+  int64_t exp = 1;
+  while (start < end && 0 == tmp_digit[start]) {
+    ++start;
+    --exp;
+  }
+  while (end > start && 0 == tmp_digit[end - 1]) {
+    --end;
+  }
+  res_desc.desc_ = 0;
+  res_desc.sign_ = POSITIVE;
+  if (start < end) {
+    for (int64_t i = start; i < end; ++i) {
+      res_digit[i - start] = tmp_digit[i];
+    }
+    res_desc.len_ = static_cast<uint8_t>(end - start);
+    res_desc.exp_ = 0x7f & (uint8_t)(EXP_ZERO + exp);
+    if (value < 0) {
+      res_desc.sign_ = NEGATIVE;
+      res_desc.exp_ = (0x7f & (~res_desc.exp_)) + 1;
+    }
+  }
+  res_desc.reserved_ = 0;
+}
+
+OB_INLINE bool ObNumber::try_fast_scaled_add_sub(const ObNumber &l_num, const ObNumber &r_num,
+                                                 const bool is_minus,
+                                                 uint32_t *res_digit, Desc &res_desc)
+{
+  int64_t l_val = 0;
+  int64_t r_val = 0;
+  bool is_fast_panel = get_scaled_int64(l_num, l_val) && get_scaled_int64(r_num, r_val);
+  if (is_fast_panel) {
+    // |l_val|, |r_val| < BASE * BASE, no overflow
+    from_scaled_int64(is_minus ? l_val - r_val : l_val + r_val, res_digit, res_desc);
   }
   return is_fast_panel;
 }
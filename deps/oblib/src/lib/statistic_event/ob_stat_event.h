@@ -34,6 +34,11 @@ STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_PACKET_CNT, "rpc stream compre
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_ORIGINAL_SIZE, "rpc stream compress original size", ObStatClassIds::NETWORK, "rpc stream compress original size", 10018, true, true)
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_SIZE, "rpc stream compress compressed size", ObStatClassIds::NETWORK, "rpc stream compress compressed size", 10019, true, true)
 
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_PACKET_CNT, "mysql compress packet cnt", ObStatClassIds::NETWORK, "mysql compress packet cnt", 10020, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_ORIGINAL_SIZE, "mysql compress original size", ObStatClassIds::NETWORK, "mysql compress original size", 10021, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_COMPRESSED_SIZE, "mysql compress compressed size", ObStatClassIds::NETWORK, "mysql compress compressed size", 10022, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_TIME, "mysql compress time", ObStatClassIds::NETWORK, "mysql compress time", 10023, true, true)
+
 // QUEUE
 // STAT_EVENT_ADD_DEF(REQUEST_QUEUED_COUNT, "REQUEST_QUEUED_COUNT", QUEUE, "REQUEST_QUEUED_COUNT")
 STAT_EVENT_ADD_DEF(REQUEST_ENQUEUE_COUNT, "request enqueue count", ObStatClassIds::QUEUE, "request enqueue count", 20000, true, true)
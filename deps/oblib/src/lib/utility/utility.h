@@ -28,6 +28,7 @@
 #define OB_FALSE_IT(stmt) ({ (stmt); false; })
 
 #define CPUID_STD_SSE4_2 0x00100000
+#define CPUID_EXT_AVX2 0x00000020
 
 #define htonll(i) \
   ( \
@@ -541,6 +542,22 @@ inline bool is_cpu_support_sse42()
  #endif
 }
 
+inline bool is_cpu_support_avx2()
+{
+ #if defined (__x86_64__)
+  uint32_t a, b, c, d;
+  asm("cpuid"
+      : "=a"(a), "=b"(b), "=c"(c), "=d"(d)
+      : "a"(7), "c"(0)
+      :);
+  return 0 != (b & CPUID_EXT_AVX2);
+ #elif defined(__aarch64__)
+  return 0;
+ #else
+  #error arch unsupported
+ #endif
+}
+
 ///@brief Whether s1 is equal to s2, ignoring case and regarding space between words as one blank.
 ///If equal, return true. Otherwise, return false.
 ///
@@ -14,6 +14,7 @@
 #include "lib/allocator/ob_malloc.h"
 #include "lib/compress/zlib/ob_zlib_compressor.h"
 #include "lib/stat/ob_diagnose_info.h"
+#include "lib/time/ob_time_utility.h"
 #include "rpc/ob_request.h"
 #include "rpc/obmysql/ob_mysql_util.h"
 #include "rpc/obmysql/ob_mysql_packet.h"
@@ -73,7 +74,7 @@ static int build_compressed_packet(ObEasyBuffer &src_buf,
   } else {
     ObEasyBuffer dst_buf(*context.send_buf_);
     const int64_t comp_buf_size = dst_buf.write_avail_size() - OB_MYSQL_COMPRESSED_HEADER_SIZE;
-    ObZlibCompressor compressor;
+    ObZlibCompressor compressor(context.compress_level_);
     bool use_real_compress = true;
     if (context.use_checksum()) {
       compressor.set_compress_level(0);
@@ -83,6 +84,7 @@ static int build_compressed_packet(ObEasyBuffer &src_buf,
     int64_t pos = 0;
     int64_t len_before_compress = 0;
     if (use_real_compress) {
+      const int64_t begin_ts = ObTimeUtility::fast_current_time();
       if (OB_FAIL(compressor.compress(src_buf.read_pos(), next_compress_size,
                                       dst_buf.last() + OB_MYSQL_COMPRESSED_HEADER_SIZE,
                                       comp_buf_size, dst_data_size))) {
@@ -93,6 +95,12 @@ static int build_compressed_packet(ObEasyBuffer &src_buf,
                    K(dst_data_size), K(comp_buf_size), K(ret));
       } else {
         len_before_compress = next_compress_size;
+        if (!context.use_checksum()) {
+          EVENT_INC(MYSQL_COMPRESS_PACKET_CNT);
+          EVENT_ADD(MYSQL_COMPRESS_ORIGINAL_SIZE, next_compress_size);
+          EVENT_ADD(MYSQL_COMPRESS_COMPRESSED_SIZE, dst_data_size);
+          EVENT_ADD(MYSQL_COMPRESS_TIME, ObTimeUtility::fast_current_time() - begin_ts);
+        }
       }
     } else {
       //if compress off, just copy date to output buf
@@ -39,6 +39,7 @@ class ObCompressionContext;
 static const int64_t OB_PROXY_MAX_COMPRESSED_PACKET_LENGTH = (1L << 15); //32K
 static const int64_t OB_MAX_COMPRESSED_PACKET_LENGTH = (1L << 20); //1M
 static const int64_t MAX_COMPRESSED_BUF_SIZE = common::OB_MALLOC_BIG_BLOCK_SIZE;//2M-1k
+static const int64_t OB_MYSQL_DEFAULT_COMPRESS_LEVEL = 6; // zlib default level
 
 class ObMysqlPktContext
 {
@@ -226,7 +227,11 @@ public:
   ObCompressionContext() { reset(); }
   ~ObCompressionContext() {}
 
-  void reset() { memset(this, 0, sizeof(ObCompressionContext)); }
+  void reset()
+  {
+    memset(this, 0, sizeof(ObCompressionContext));
+    compress_level_ = OB_MYSQL_DEFAULT_COMPRESS_LEVEL;
+  }
   bool use_compress() const { return NO_COMPRESS != type_; }
   bool use_uncompress() const { return NO_COMPRESS == type_; }
   bool is_proxy_compress() const { return PROXY_COMPRESS == type_; }
@@ -263,7 +268,7 @@ public:
   {
     int64_t pos = 0;
     J_OBJ_START();
-    J_KV(K_(sessid), K_(type), K_(is_checksum_off), K_(seq), KP_(last_pkt_pos));
+    J_KV(K_(sessid), K_(type), K_(is_checksum_off), K_(seq), KP_(last_pkt_pos), K_(compress_level));
     J_COMMA();
     if (NULL != send_buf_) {
       J_KV("send_buf", ObEasyBuffer(*send_buf_));
@@ -281,6 +286,7 @@ public:
   easy_buf_t *send_buf_;
   char *last_pkt_pos_;//proxy last pkt(error+ok, eof+ok, ok)'s pos in orig_ezbuf, default is null
   uint32_t sessid_;
+  int64_t compress_level_;//zlib level of DEFAULT_COMPRESS and PROXY_COMPRESS
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObCompressionContext);
@@ -384,6 +384,29 @@ public:
     last_write_time_ = ObTimeUtility::current_time();
     return ret;
   }
+  // write until socket buffer is full, never wait
+  int try_write_data(const char* buf, int64_t sz, int64_t& wbytes) {
+    int ret = OB_SUCCESS;
+    bool is_full = false;
+    wbytes = 0;
+    while(wbytes < sz && !is_full && OB_SUCCESS == ret) {
+      int64_t cur_wbytes = 0;
+      if ((cur_wbytes = write(fd_, buf + wbytes, sz - wbytes)) >= 0) {
+        wbytes += cur_wbytes;
+      } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
+        is_full = true;
+      } else if (EINTR == errno) {
+        // pass
+      } else {
+        ret = OB_IO_ERROR;
+        LOG_WARN("write data error", K(errno));
+      }
+    }
+    if (wbytes >= sz) {
+      last_write_time_ = ObTimeUtility::current_time();
+    }
+    return ret;
+  }
   const rpc::TraceId* get_trace_id() const {
     ObSqlSockSession* sess = (ObSqlSockSession *)sess_;
     return &(sess->sql_req_.get_trace_id());
@@ -942,5 +965,10 @@ void ObSqlNio::async_write_data(void* sess, const char* buf, int64_t sz)
   sock->get_nio_impl().push_write_req(sock);
 }
 
+int ObSqlNio::try_write_data(void* sess, const char* buf, int64_t sz, int64_t& wbytes)
+{
+  return sess2sock(sess)->try_write_data(buf, sz, wbytes);
+}
+
 }; // end namespace obmysql
 }; // end namespace oceanbase
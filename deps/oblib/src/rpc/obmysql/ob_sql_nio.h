@@ -35,6 +35,7 @@ public:
   int consume_data(void* sess, int64_t sz);
   int write_data(void* sess, const char* buf, int64_t sz);
   void async_write_data(void* sess, const char* buf, int64_t sz);
+  int try_write_data(void* sess, const char* buf, int64_t sz, int64_t& wbytes);
   void stop();
   void wait();
   void destroy();
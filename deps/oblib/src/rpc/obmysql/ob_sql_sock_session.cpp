@@ -76,9 +76,18 @@ void ObSqlSockSession::revert_sock()
   if (pending_write_buf_) {
     const char * data = pending_write_buf_;
     int64_t sz = pending_write_sz_;
+    int64_t wbytes = 0;
     pending_write_buf_ = NULL;
     pending_write_sz_ = 0;
-    nio_.async_write_data((void*)this, data, sz);
+    // write the response in worker thread first, so that the next pipelined request
+    // already in read buffer is delivered right away instead of after a round trip
+    // through the epoll thread. Hand over to epoll thread only if the socket is full.
+    if (OB_SUCCESS == nio_.try_write_data((void*)this, data, sz, wbytes) && wbytes >= sz) {
+      pool_.reuse();
+      nio_.revert_sock((void*)this);
+    } else {
+      nio_.async_write_data((void*)this, data + wbytes, sz - wbytes);
+    }
   } else {
     pool_.reuse();
     nio_.revert_sock((void*)this);
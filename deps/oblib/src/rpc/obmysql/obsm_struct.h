@@ -65,6 +65,7 @@ public:
     proxy_version_ = 0;
     group_id_ = 0;
     client_cs_type_ = 0;
+    compress_level_ = obmysql::OB_MYSQL_DEFAULT_COMPRESS_LEVEL;
   }
 
   obmysql::ObCompressType get_compress_type() {
@@ -180,6 +181,7 @@ public:
   uint64_t proxy_version_;
   int32_t group_id_;
   int32_t client_cs_type_;
+  int64_t compress_level_; // zlib level of compressed packets sent to client
 };
 } // end of namespace observer
 } // end of namespace oceanbase
@@ -17,6 +17,7 @@
 #include <codecvt>
 #include "lib/charset/ob_charset.h"
 #include "lib/string/ob_string.h"
+#include "lib/hash_func/murmur_hash.h"
 #include "lib/utility/ob_print_utils.h"
 #include "gtest/gtest.h"
 #include "unicode_map.h"
@@ -214,6 +215,35 @@ TEST_F(TestCharset, hash_sort)
   ASSERT_EQ(ret2, ret3);
 }
 
+static uint64_t test_hash_algo(const void *input, uint64_t length, uint64_t seed)
+{
+  return murmurhash64A(input, static_cast<int32_t>(length), seed);
+}
+
+TEST_F(TestCharset, ascii_fast_path)
+{
+  // longer than one 16 bytes block, ascii case differences and non-ascii characters
+  // in the middle and at the block boundary
+  const char *a = "select_Column_Name_From_t1_Where_\xC3\xA9_order_by_1";
+  const char *b = "SELECT_column_name_from_T1_where_E_ORDER_BY_1";
+  const char *c = "select_column_name_from_t1_where_e_order_by_2";
+  const char *d = "select_column_name_from_t1_where_e_order_by_1   ";
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), b, strlen(b), false));
+  ASSERT_EQ(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), b, strlen(b)));
+  ASSERT_EQ(-1, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), c, strlen(c), false));
+  ASSERT_EQ(1, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, c, strlen(c), a, strlen(a), false));
+  ASSERT_EQ(0, ObCharset::strcmpsp(CS_TYPE_UTF8MB4_GENERAL_CI, d, strlen(d), b, strlen(b), false));
+  ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, b, strlen(b), c, strlen(c), false) < 0);
+  ASSERT_TRUE(ObCharset::strcmpsp(CS_TYPE_UTF8MB4_BIN, d, strlen(d), c, strlen(c), false) < 0);
+
+  const uint64_t hash_a = ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0);
+  ASSERT_EQ(hash_a, ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), 0));
+  ASSERT_EQ(hash_a, ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, d, strlen(d), 0));
+  ASSERT_NE(hash_a, ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, c, strlen(c), 0));
+  const uint64_t murmur_a = ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0, false, test_hash_algo);
+  ASSERT_EQ(murmur_a, ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), 0, false, test_hash_algo));
+}
+
 TEST_F(TestCharset, case_mode_equal)
 {
   ObString y1= "Variable_name";
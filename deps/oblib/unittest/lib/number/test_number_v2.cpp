@@ -4342,6 +4342,55 @@ TEST(ObNumber, arithmetic_cmp_v2)
   }
 }
 
+TEST(ObNumber, fast_scaled_add_sub)
+{
+  const int64_t MAX_TEST_COUNT = 100000;
+  const int64_t MAX_BUF_SIZE = 256;
+  char buf_alloc[MAX_BUF_SIZE];
+  ObDataBuffer allocator(buf_alloc, MAX_BUF_SIZE);
+  char str1[64];
+  char str2[64];
+  uint32_t res_digits[ObNumber::MAX_STORE_LEN];
+  for (int64_t i = 0; i < MAX_TEST_COUNT; ++i) {
+    // mix of integers, DECIMAL(18, 2)-like and pure fragment values of both signs
+    const char *sign1 = (0 == rand() % 2) ? "-" : "";
+    const char *sign2 = (0 == rand() % 2) ? "-" : "";
+    const int64_t int1 = (0 == i % 5) ? 0 : rand() % ObNumber::BASE;
+    const int64_t int2 = (0 == i % 7) ? ObNumber::BASE - 1 : rand() % ObNumber::BASE;
+    snprintf(str1, sizeof(str1), "%s%ld.%02d", sign1, int1, rand() % 100);
+    snprintf(str2, sizeof(str2), "%s%ld.%09d", sign2, int2, (0 == i % 3) ? 0 : rand() % ObNumber::BASE);
+    ObNumber num1;
+    ObNumber num2;
+    ObNumber value_v2;
+    ObNumber value_v3;
+    ObNumber::Desc res_desc;
+    ASSERT_EQ(OB_SUCCESS, num1.from(str1, allocator));
+    ASSERT_EQ(OB_SUCCESS, num2.from(str2, allocator));
+
+    ASSERT_TRUE(ObNumber::try_fast_add(num1, num2, res_digits, res_desc));
+    ObNumber fast_value(res_desc.desc_, res_digits);
+    ASSERT_EQ(OB_SUCCESS, num1.add_v2(num2, value_v2, allocator));
+    ASSERT_EQ(OB_SUCCESS, num1.add_v3(num2, value_v3, allocator));
+    ASSERT_EQ(0, value_v2.compare(fast_value)) << str1 << " + " << str2;
+    ASSERT_EQ(0, value_v2.compare(value_v3)) << str1 << " + " << str2;
+    ASSERT_EQ(value_v2.d_.desc_, res_desc.desc_) << str1 << " + " << str2;
+
+    ASSERT_TRUE(ObNumber::try_fast_minus(num1, num2, res_digits, res_desc));
+    fast_value.assign(res_desc.desc_, res_digits);
+    ASSERT_EQ(OB_SUCCESS, num1.sub_v2(num2, value_v2, allocator));
+    ASSERT_EQ(OB_SUCCESS, num1.sub_v3(num2, value_v3, allocator));
+    ASSERT_EQ(0, value_v2.compare(fast_value)) << str1 << " - " << str2;
+    ASSERT_EQ(0, value_v2.compare(value_v3)) << str1 << " - " << str2;
+    ASSERT_EQ(value_v2.d_.desc_, res_desc.desc_) << str1 << " - " << str2;
+    allocator.free();
+  }
+  ObNumber big;
+  ObNumber::Desc res_desc;
+  ASSERT_EQ(OB_SUCCESS, big.from("1234567890.5", allocator));
+  ASSERT_FALSE(ObNumber::try_fast_add(big, big, res_digits, res_desc));
+  ASSERT_EQ(OB_SUCCESS, big.from("0.0000000001", allocator));
+  ASSERT_FALSE(ObNumber::try_fast_minus(big, big, res_digits, res_desc));
+}
 
 TEST(ObNumber, DISABLED_arithmetic_perf_v2)
 {
@@ -131,11 +131,26 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   bool is_packed = result.get_physical_plan() ? result.get_physical_plan()->is_packed() : false;
   MYSQL_PROTOCOL_TYPE protocol_type = is_ps_protocol ? BINARY : TEXT;
   const common::ColumnsFieldIArray *fields = NULL;
+  // session states below do not change during the response, get them once
+  // instead of once per row or per cell
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
+  const bool is_use_lob_locator = session_.is_client_use_lob_locator();
+  ObCharsetType charset_type = CHARSET_INVALID;
+  ObArenaAllocator *convert_allocator = NULL;
   if (OB_SUCC(ret)) {
     fields = result.get_field_columns();
     if (OB_ISNULL(fields)) {
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("fields is null", K(ret), KP(fields));
+    } else if (is_packed) {
+      // packed row is sent as is, no charset convert
+    } else if (OB_FAIL(result.get_exec_context().get_convert_charset_allocator(convert_allocator))) {
+      LOG_WARN("fail to get convert charset allocator", K(ret));
+    } else if (OB_ISNULL(convert_allocator)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("convert charset allocator is null", K(ret));
+    } else if (OB_FAIL(session_.get_character_set_results(charset_type))) {
+      LOG_WARN("fail to get result charset", K(ret));
     }
   }
   while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
@@ -170,20 +185,20 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       if (OB_SUCC(ret) && !is_packed) {
         if (ob_is_string_type(value.get_type())
                   && CS_TYPE_INVALID != value.get_collation_type()) {
-          OZ(convert_string_value_charset(value, result));
+          OZ(convert_string_value_charset(value, charset_type, *convert_allocator));
         } else if (value.is_clob_locator()
-                  && OB_FAIL(convert_lob_value_charset(value, result))) {
+                  && OB_FAIL(convert_lob_value_charset(value, charset_type, *convert_allocator))) {
           LOG_WARN("convert lob value charset failed", K(ret));
         }
         if (OB_SUCC(ret) && lib::is_oracle_mode()
                         && (value.is_lob() || value.is_lob_locator())
-                        && OB_FAIL(convert_lob_locator_to_longtext(value, result))) {
+                        && OB_FAIL(convert_lob_locator_to_longtext(value, is_use_lob_locator,
+                                                                   convert_allocator))) {
           LOG_WARN("convert lob locator to longtext failed", K(ret));
         }
       }
     }
     if (OB_SUCC(ret)) {
-      const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
       ObSMRow sm(protocol_type, *row, dtc_params,
                          result.get_field_columns(),
                          ctx_.schema_guard_,
@@ -197,6 +212,11 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
         // break;
       } else {
         LOG_DEBUG("response row succ", K(*row));
+        // the row has been encoded into packet buffer, release converted values of it,
+        // otherwise memory grows with the size of result set
+        if (OB_NOT_NULL(convert_allocator)) {
+          convert_allocator->reset();
+        }
       }
       if (OB_SUCC(ret)) {
         ++row_num;
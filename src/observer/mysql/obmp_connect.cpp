@@ -263,6 +263,10 @@ int ObMPConnect::process()
     } else {
       // set connection info to session
       session->set_ob20_protocol(conn->proxy_cap_flags_.is_ob_protocol_v2_support());
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
+      if (tenant_config.is_valid()) {
+        conn->compress_level_ = tenant_config->_mysql_compress_level;
+      }
 
       LOG_TRACE("setup user resource group OK",
                "user_id", session->get_user_id(),
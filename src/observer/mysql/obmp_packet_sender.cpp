@@ -158,6 +158,7 @@ int ObMPPacketSender::do_init(rpc::ObRequest *req,
     comp_context_.type_ = conn->get_compress_type();
     comp_context_.seq_ = seq_;
     comp_context_.sessid_ = sessid_;
+    comp_context_.compress_level_ = conn->compress_level_;
 
     // init proto20 context
     bool is_proto20_supported = (OB_2_0_CS_TYPE == conn->get_cs_protocol_type());
@@ -853,6 +853,14 @@ int ObGVSql::fill_cells(const ObPlanCacheObject *cache_obj, const ObPlanCache &p
       cells[i].set_int(cache_obj->get_obj_status());
       break;
     }
+    case share::ALL_VIRTUAL_PLAN_STAT_CDE::CARD_MISESTIMATE_COUNT: {
+      if (cache_obj->is_sql_crsr()) {
+        cells[i].set_int(plan->stat_.card_misestimate_count_);
+      } else {
+        cells[i].set_int(0);
+      }
+      break;
+    }
     default: {
       ret = OB_ERR_UNEXPECTED;
       SERVER_LOG(WARN,
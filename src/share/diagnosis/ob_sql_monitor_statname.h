@@ -44,6 +44,16 @@ SQL_MONITOR_STATNAME_DEF(MEMORY_DUMP, sql_monitor_statname::CAPACITY, "memory du
 // GI
 SQL_MONITOR_STATNAME_DEF(FILTERED_GRANULE_COUNT, sql_monitor_statname::INT, "filtered granule count", "filtered granule count in GI op")
 SQL_MONITOR_STATNAME_DEF(TOTAL_GRANULE_COUNT, sql_monitor_statname::INT, "total granule count", "total granule count in GI op")
+// No work stealing: a granule being scanned is never split to idle workers, these
+// stats only expose the skew. In vectorized mode busy time excludes the time blocked
+// on the parent.
+SQL_MONITOR_STATNAME_DEF(GRANULE_BUSY_TIME, sql_monitor_statname::INT, "granule busy time", "time spent inside the child scan of granules by this worker in GI op (per batch in vectorized mode, per granule in row mode), in microseconds")
+SQL_MONITOR_STATNAME_DEF(GRANULE_FETCH_TIME, sql_monitor_statname::INT, "granule fetch time", "time spent fetching and pruning granules by this worker in GI op, in microseconds")
+SQL_MONITOR_STATNAME_DEF(GRANULE_EXHAUSTED_TIMESTAMP, sql_monitor_statname::TIMESTAMP, "granule exhausted time", "the timestamp when no more granule is left for this worker in GI op")
+// HASH SET
+SQL_MONITOR_STATNAME_DEF(HASH_SET_DUMP_FILTERED_COUNT, sql_monitor_statname::INT, "dump filtered row count", "right rows not dumped since no dumped left row can match them in hash set op")
+SQL_MONITOR_STATNAME_DEF(HASH_SET_MAX_PART_LEVEL, sql_monitor_statname::INT, "max partition level", "max recursive partition level processed by hash set op")
+SQL_MONITOR_STATNAME_DEF(HASH_SET_MAX_ROUND_MEM, sql_monitor_statname::CAPACITY, "max round memory", "max memory used by one partition round of hash set op")
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
 #endif
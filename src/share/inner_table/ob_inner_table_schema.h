@@ -97,7 +97,8 @@ struct ALL_VIRTUAL_PLAN_STAT_CDE {
     HINTS_ALL_WORKED,
     PL_SCHEMA_ID,
     IS_BATCHED_MULTI_STMT,
-    OBJECT_STATUS
+    OBJECT_STATUS,
+    CARD_MISESTIMATE_COUNT
   };
 };
 
@@ -220,7 +221,8 @@ struct ALL_VIRTUAL_PLAN_STAT_ORA_CDE {
     HINTS_ALL_WORKED,
     PL_SCHEMA_ID,
     IS_BATCHED_MULTI_STMT,
-    OBJECT_STATUS
+    OBJECT_STATUS,
+    CARD_MISESTIMATE_COUNT
   };
 };
 
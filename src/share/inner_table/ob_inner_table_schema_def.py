@@ -5688,6 +5688,7 @@ def_table_schema(
       ('pl_schema_id', 'uint'),
       ('is_batched_multi_stmt', 'bool'),
       ('object_status', 'int'),
+      ('card_misestimate_count', 'int'),
   ],
   vtable_route_policy = 'distributed',
   partition_columns = ['svr_ip', 'svr_port'],
@@ -316,6 +316,11 @@ DEF_INT(_rowsets_target_maxsize, OB_TENANT_PARAMETER, "524288", "[262144, 838860
 DEF_INT(_rowsets_max_rows, OB_TENANT_PARAMETER, "256", "[0, 65535]",
         "the row number processed by vectorized sql engine within one batch. Range: [0, 65535]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_mysql_compress_level, OB_TENANT_PARAMETER, "6", "[1, 9]",
+        "zlib compression level of packets sent to clients using compressed mysql protocol, "
+        "lower level costs less cpu but saves less bandwidth. "
+        "Takes effect on new connections. Range: [1, 9]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR_WITH_CHECKER(_ctx_memory_limit, OB_TENANT_PARAMETER, "",
         common::ObCtxMemoryLimitChecker,
         "specifies tenant ctx memory limit.",
@@ -323,6 +328,10 @@ DEF_STR_WITH_CHECKER(_ctx_memory_limit, OB_TENANT_PARAMETER, "",
 DEF_BOOL(_enable_convert_real_to_decimal, OB_TENANT_PARAMETER, "False",
          "specifies whether convert column type float(M,D), double(M,D) to decimal(M,D) in DDL",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_column_group_selectivity, OB_TENANT_PARAMETER, "False",
+         "specifies whether equal filters on several columns of one table are estimated "
+         "together with exponential backoff instead of assuming the columns are independent",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 
 // tenant memtable consumption related
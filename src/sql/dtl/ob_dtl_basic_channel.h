@@ -246,6 +246,10 @@ public:
   {
     register_block_ptr_ = block_ptr;
   }
+  // Keep row pointers swizzled, the receiver uses the block in place without swizzling.
+  // Only valid when the buffer is handed over in the same process and never copied.
+  void set_swizzled(const bool swizzled) { swizzled_ = swizzled; }
+  bool is_swizzled() const { return swizzled_; }
   virtual void write_msg_type(ObDtlLinkedBuffer* buffer)
   {
     buffer->msg_type() = ObDtlMsgType::PX_DATUM_ROW;
@@ -257,6 +261,7 @@ private:
   ObChunkDatumStore::Block** register_block_ptr_;
   ObChunkDatumStore::BlockBufferWrap* register_block_buf_ptr_;
   int write_ret_;
+  bool swizzled_;
 };
 
 OB_INLINE int ObDtlDatumMsgWriter::write(
@@ -266,7 +271,7 @@ OB_INLINE int ObDtlDatumMsgWriter::write(
   const ObPxNewRow &px_row = static_cast<const ObPxNewRow&>(msg);
   const ObIArray<ObExpr *> *row = px_row.get_exprs();
   if (nullptr != row) {
-    if (OB_FAIL(block_->append_row(*row, eval_ctx, block_->get_buffer(), 0, nullptr, true))) {
+    if (OB_FAIL(block_->append_row(*row, eval_ctx, block_->get_buffer(), 0, nullptr, !swizzled_))) {
       if (OB_BUF_NOT_ENOUGH != ret) {
         SQL_DTL_LOG(WARN, "failed to add row", K(ret));
       } else {
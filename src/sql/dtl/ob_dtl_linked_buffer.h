@@ -22,6 +22,8 @@ namespace sql {
 namespace dtl {
 
 #define DTL_BROADCAST (1ULL)
+// rows of datum block keep absolute pointers, only for same process channel
+#define DTL_ROWS_SWIZZLED (1ULL << 1)
 
 struct ObDtlMsgHeader;
 class ObDtlChannel;
@@ -258,6 +260,14 @@ public:
     remove_flag(DTL_BROADCAST);
   }
 
+  bool is_rows_swizzled() const {
+    return has_flag(DTL_ROWS_SWIZZLED);
+  }
+
+  void set_rows_swizzled(bool swizzled) {
+    swizzled ? add_flag(DTL_ROWS_SWIZZLED) : remove_flag(DTL_ROWS_SWIZZLED);
+  }
+
   //不包含allocated_chid_ copy，谁申请谁释放
   static void assign(const ObDtlLinkedBuffer &src, ObDtlLinkedBuffer *dst) {
     MEMCPY(dst->buf_, src.buf_, src.size_);
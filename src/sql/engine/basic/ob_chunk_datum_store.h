@@ -585,14 +585,17 @@ public:
 
   class BlockBufferWrap : public BlockBuffer {
   public:
-    BlockBufferWrap() : BlockBuffer(), rows_(0) {}
+    BlockBufferWrap() : BlockBuffer(), rows_(0), unswizzling_(true) {}
 
     int append_row(const common::ObIArray<ObExpr*> &exprs,
                    ObEvalCtx *ctx, int64_t row_extend_size);
     void reset() { rows_ = 0; BlockBuffer::reset(); }
+    void set_unswizzling(const bool unswizzling) { unswizzling_ = unswizzling; }
 
   public:
     uint32_t rows_;
+    // rows stored with offset instead of pointer, needed when block is copied or sent by rpc
+    bool unswizzling_;
   };
 
   class ChunkIterator;
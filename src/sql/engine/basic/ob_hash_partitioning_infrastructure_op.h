@@ -22,6 +22,7 @@
 #include "sql/engine/expr/ob_expr.h"
 #include "lib/hash/ob_array_hash_map.h"
 #include "sql/engine/aggregate/ob_adaptive_bypass_ctrl.h"
+#include "sql/engine/aggregate/ob_exec_hash_struct.h"
 
 namespace oceanbase
 {
@@ -247,7 +248,8 @@ public:
     left_part_cur_id_(0), right_part_cur_id_(0), my_skip_(nullptr),
     items_(nullptr), distinct_map_(), hash_col_buffer_(nullptr),
     hash_col_buffer_idx_(MAX_HASH_COL_CNT), is_push_down_(false),
-    store_row_buffer_(nullptr), store_row_buffer_cnt_(0)
+    store_row_buffer_(nullptr), store_row_buffer_cnt_(0),
+    enable_left_dump_filter_(false), left_dump_filter_(nullptr), dump_filtered_row_cnt_(0)
   {}
   ~ObHashPartInfrastructure();
 public:
@@ -383,6 +385,8 @@ private:
   void clean_cur_dumping_partitions();
 
   int update_mem_status_periodically();
+  int create_left_dump_filter();
+  void destroy_left_dump_filter();
 public:
   int init(uint64_t tenant_id, bool enable_sql_dumped, bool unique, bool need_pre_part,
     int64_t ways, ObSqlMemMgrProcessor *sql_mem_processor);
@@ -394,6 +398,13 @@ public:
   { cur_side_ = InputSide::RIGHT; }
 
   int exists_row(const common::ObIArray<ObExpr*> &exprs, const HashCol *&exists_part_cols);
+  // Used by intersect and except: right row which is not found in hash table only need to be
+  // dumped if it may match some left row dumped in this round.
+  int may_exist_in_left_dumped(const common::ObIArray<ObExpr*> &exprs, bool &may_exist);
+  void enable_left_dump_filter() { enable_left_dump_filter_ = true; }
+  int64_t get_dump_filtered_row_cnt() const { return dump_filtered_row_cnt_; }
+  int64_t get_cur_level() const { return cur_level_; }
+  int64_t get_cur_mem_used() { return get_mem_used(); }
   int exists_batch(const common::ObIArray<ObExpr*> &exprs, const int64_t batch_size,
                    const ObBitVector *child_skip, ObBitVector *skip,
                    uint64_t *hash_values_for_batch);
@@ -703,6 +714,10 @@ private:
   bool is_push_down_;
   ObChunkDatumStore::StoredRow **store_row_buffer_;
   int64_t store_row_buffer_cnt_;
+  // bloom filter of left rows dumped in current round, see may_exist_in_left_dumped()
+  bool enable_left_dump_filter_;
+  ObGbyBloomFilter *left_dump_filter_;
+  int64_t dump_filtered_row_cnt_;
 };
 
 //////////////////// start ObHashPartInfrastructure //////////////////
@@ -927,6 +942,9 @@ void ObHashPartInfrastructure<HashCol, HashRowStore>::reset()
   store_row_buffer_ = nullptr;
   store_row_buffer_cnt_ = 0;
   io_event_observer_ = nullptr;
+  destroy_left_dump_filter();
+  enable_left_dump_filter_ = false;
+  dump_filtered_row_cnt_ = 0;
   if (OB_NOT_NULL(arena_alloc_)) {
     arena_alloc_->reset();
   }
@@ -1179,6 +1197,7 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::end_round()
     hash_col_buffer_ = nullptr;
     store_row_buffer_ = nullptr;
     store_row_buffer_cnt_ = 0;
+    destroy_left_dump_filter();
     if (OB_NOT_NULL(arena_alloc_)) {
       arena_alloc_->reset();
     }
@@ -1285,6 +1304,9 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::insert_row_on_partitions(
       int64_t part_idx = get_part_idx(hash_value);
       if (OB_FAIL(cur_dumped_parts_[part_idx]->store_.add_row(exprs, eval_ctx_, &sr))) {
         SQL_ENG_LOG(WARN, "failed to add row", K(ret));
+      } else if (is_left() && OB_NOT_NULL(left_dump_filter_)
+                 && OB_FAIL(left_dump_filter_->set(hash_value))) {
+        SQL_ENG_LOG(WARN, "failed to add hash value to bloom filter", K(ret));
       } else {
         HashRowStore *store_row = static_cast<HashRowStore*>(sr);
         store_row->set_hash_value(hash_value);
@@ -1319,6 +1341,9 @@ insert_batch_on_partitions(const common::ObIArray<ObExpr *> &exprs,
       int64_t part_idx = get_part_idx(hash_values[i]);
       if (OB_FAIL(cur_dumped_parts_[part_idx]->store_.add_row(exprs, eval_ctx_, &sr))) {
         SQL_ENG_LOG(WARN, "failed to add row", K(ret));
+      } else if (is_left() && OB_NOT_NULL(left_dump_filter_)
+                 && OB_FAIL(left_dump_filter_->set(hash_values[i]))) {
+        SQL_ENG_LOG(WARN, "failed to add hash value to bloom filter", K(ret));
       } else {
         HashRowStore *store_row = static_cast<HashRowStore *>(sr);
         uint64_t hash_value = 0;
@@ -1566,6 +1591,9 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::create_dumped_partitions(
         left_dumped_parts_ = cur_dumped_parts_;
         left_part_cur_id_ = cur_part_start_id_ + est_part_cnt_;
         SQL_ENG_LOG(TRACE, "left is dumped", K(ret));
+        if (enable_left_dump_filter_ && OB_FAIL(create_left_dump_filter())) {
+          SQL_ENG_LOG(WARN, "failed to create left dump filter", K(ret));
+        }
       }
     } else {
       if (OB_NOT_NULL(right_dumped_parts_)) {
@@ -1599,6 +1627,58 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_row(
   return ret;
 }
 
+template<typename HashCol, typename HashRowStore>
+int ObHashPartInfrastructure<HashCol, HashRowStore>::may_exist_in_left_dumped(
+  const common::ObIArray<ObExpr*> &exprs,
+  bool &may_exist)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_value = 0;
+  may_exist = has_left_dumped();
+  if (!may_exist || OB_ISNULL(left_dump_filter_)) {
+  } else if (OB_FAIL(calc_hash_value(exprs, hash_value))) {
+    SQL_ENG_LOG(WARN, "failed to calc hash value", K(ret));
+  } else if (!left_dump_filter_->exist(hash_value)) {
+    may_exist = false;
+    ++dump_filtered_row_cnt_;
+  }
+  return ret;
+}
+
+// The bloom filter only records left rows dumped after the hash table is full, rows kept in
+// hash table are probed directly. Size it by the hash table size like hash group by does.
+template<typename HashCol, typename HashRowStore>
+int ObHashPartInfrastructure<HashCol, HashRowStore>::create_left_dump_filter()
+{
+  int ret = OB_SUCCESS;
+  void *mem = nullptr;
+  destroy_left_dump_filter();
+  ModulePageAllocator mod_alloc("HashInfraBloom", tenant_id_, ObCtxIds::WORK_AREA);
+  mod_alloc.set_allocator(alloc_);
+  if (OB_ISNULL(mem = alloc_->alloc(sizeof(ObGbyBloomFilter)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SQL_ENG_LOG(WARN, "failed to allocate memory", K(ret));
+  } else if (FALSE_IT(left_dump_filter_ = new (mem) ObGbyBloomFilter(mod_alloc))) {
+  } else if (OB_FAIL(left_dump_filter_->init(hash_table_.size() > MIN_BUCKET_NUM
+                                             ? hash_table_.size() : MIN_BUCKET_NUM))) {
+    SQL_ENG_LOG(WARN, "failed to init bloom filter", K(ret));
+    destroy_left_dump_filter();
+  }
+  return ret;
+}
+
+template<typename HashCol, typename HashRowStore>
+void ObHashPartInfrastructure<HashCol, HashRowStore>::destroy_left_dump_filter()
+{
+  if (OB_NOT_NULL(left_dump_filter_)) {
+    left_dump_filter_->~ObGbyBloomFilter();
+    if (OB_NOT_NULL(alloc_)) {
+      alloc_->free(left_dump_filter_);
+    }
+    left_dump_filter_ = nullptr;
+  }
+}
+
 //exist function for hash intersect
 template<typename HashCol, typename HashRowStore>
 int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_batch(
@@ -1647,6 +1727,12 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_batch(
           SQL_ENG_LOG(WARN, "failed to get item", K(ret));
         } else if (OB_ISNULL(exists_part_cols)) {
           skip->set(i);
+          if (OB_NOT_NULL(left_dump_filter_)
+              && !left_dump_filter_->exist(hash_values_for_batch[i])) {
+            // no dumped left row can match, no need to dump
+            skip_for_dump.set(i);
+            ++dump_filtered_row_cnt_;
+          }
         } else if (exists_part_cols->store_row_->is_match()) {
           skip->set(i);
           //we dont need dumped this row
@@ -1969,6 +1969,294 @@ int cast_eval_arg_batch(const ObExpr &expr,
   return ret;
 }
 
+// Batch cast kernels for the most frequent (mostly implicit) cast pairs.
+// cast_eval_arg_batch() evaluates each row through ObExpr::eval() and the per-row cast
+// function, which dispatches and evaluates the argument again per row. The kernels below
+// visit the batch datums of the argument directly and the per-row cast operation is
+// inlined into the loop by template. The null check is hoisted out of the loop if all
+// argument datums are not null.
+// They are chosen in choose_cast_function() only when the per-row cast function of the
+// expr is exactly the one the kernel replaces, the results are the same.
+#define CAST_BATCH_FUNC_NAME(intype, outtype)                          \
+  int intype##_##outtype##_batch(const sql::ObExpr &expr,              \
+                                 sql::ObEvalCtx &ctx,                  \
+                                 const sql::ObBitVector &skip,         \
+                                 const int64_t batch_size)
+
+// same with EVAL_STRING_ARG(), empty string is null in oracle mode except longtext.
+static OB_INLINE bool is_null_string_arg(const ObExpr &expr, const ObDatum &arg)
+{
+  return arg.is_null() || (lib::is_oracle_mode() && 0 == arg.len_
+                           && ObLongTextType != expr.args_[0]->datum_meta_.type_);
+}
+
+template <typename CastOp>
+static int batch_cast_kernel(const ObExpr &expr,
+                             ObEvalCtx &ctx,
+                             const ObBitVector &skip,
+                             const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  const ObExpr &arg = *expr.args_[0];
+  if (OB_FAIL(arg.eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval arg failed", K(ret));
+  } else if (!arg.is_batch_result()) {
+    if (OB_FAIL(cast_eval_arg_batch(expr, ctx, skip, batch_size))) {
+      LOG_WARN("cast eval arg batch failed", K(ret));
+    }
+  } else {
+    ObDatum *results = expr.locate_batch_datums(ctx);
+    const ObDatum *args = arg.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    // not null flag can not tell empty strings, which are null in oracle mode.
+    const bool arg_notnull = arg.get_eval_info(ctx).notnull_
+        && !(CastOp::STRING_ARG && lib::is_oracle_mode());
+    // result may be null even argument is not null, e.g.: NULL_ON_WARN cast mode.
+    bool got_null = false;
+    if (arg_notnull) {
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+        if (skip.at(i) || eval_flags.at(i)) {
+          continue;
+        }
+        batch_info_guard.set_batch_idx(i);
+        if (OB_FAIL(CastOp::cast(expr, ctx, args[i], results[i]))) {
+          LOG_WARN("cast failed", K(ret), K(i));
+        } else {
+          got_null |= results[i].is_null();
+          eval_flags.set(i);
+        }
+      }
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+        if (skip.at(i) || eval_flags.at(i)) {
+          continue;
+        }
+        batch_info_guard.set_batch_idx(i);
+        if (CastOp::STRING_ARG ? is_null_string_arg(expr, args[i]) : args[i].is_null()) {
+          results[i].set_null();
+        } else if (OB_FAIL(CastOp::cast(expr, ctx, args[i], results[i]))) {
+          LOG_WARN("cast failed", K(ret), K(i));
+        }
+        if (OB_SUCC(ret)) {
+          got_null |= results[i].is_null();
+          eval_flags.set(i);
+        }
+      }
+    }
+    if (got_null) {
+      expr.get_eval_info(ctx).notnull_ = false;
+    }
+  }
+  return ret;
+}
+
+// same with CAST_FUNC_NAME(int, number)
+struct ObIntNumberBatchCast
+{
+  static const bool STRING_ARG = false;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    int64_t in_val = in.get_int();
+    ObNumStackOnceAlloc tmp_alloc;
+    number::ObNumber nmb;
+    OZ(common_int_number(expr, in_val, tmp_alloc, nmb), in_val);
+    OX(res_datum.set_number(nmb));
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(number, int), integral numbers are cast directly
+// instead of formatting to string and parsing back.
+struct ObNumberIntBatchCast
+{
+  static const bool STRING_ARG = false;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    int warning = OB_SUCCESS;
+    const number::ObNumber nmb(in.get_number());
+    int64_t int_val = 0;
+    if (nmb.is_valid_int64(int_val)) {
+      const ObObjType out_type = expr.datum_meta_.type_;
+      if (out_type < ObIntType && CAST_FAIL(int_range_check(out_type, int_val, int_val))) {
+        LOG_WARN("int_range_check failed", K(ret), K(int_val));
+      } else {
+        SET_RES_INT(int_val);
+      }
+    } else {
+      const char *nmb_buf = nmb.format();
+      if (OB_ISNULL(nmb_buf)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("nmb_buf is NULL", K(ret));
+      } else {
+        ObString num_str(strlen(nmb_buf), nmb_buf);
+        const bool is_str_int_cast = false;
+        if (OB_FAIL(common_string_int(expr, expr.extra_, num_str, is_str_int_cast, res_datum))) {
+          LOG_WARN("common_string_int failed", K(ret), K(num_str));
+        }
+      }
+    }
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(number, double), integral numbers which can be represented
+// exactly by double are cast directly instead of formatting to string and parsing back.
+struct ObNumberDoubleBatchCast
+{
+  static const bool STRING_ARG = false;
+  static const int64_t MAX_EXACT_DOUBLE_INT = 1L << 53;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    int warning = OB_SUCCESS;
+    const number::ObNumber nmb(in.get_number());
+    const ObObjType in_type = expr.args_[0]->datum_meta_.type_;
+    const ObObjType out_type = expr.datum_meta_.type_;
+    int64_t int_val = 0;
+    if (nmb.is_valid_int64(int_val)
+        && int_val <= MAX_EXACT_DOUBLE_INT && int_val >= -MAX_EXACT_DOUBLE_INT) {
+      const double out_val = static_cast<double>(int_val);
+      if (ObUDoubleType == out_type && CAST_FAIL(numeric_negative_check(out_val))) {
+        LOG_WARN("numeric_negative_check failed", K(ret), K(out_val));
+      } else {
+        SET_RES_DOUBLE(out_val);
+      }
+    } else {
+      const char *nmb_buf = nmb.format();
+      if (OB_ISNULL(nmb_buf)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("nmb_buf is NULL", K(ret));
+      } else {
+        ObString num_str(strlen(nmb_buf), nmb_buf);
+        if (OB_FAIL(common_string_double(expr, in_type, expr.args_[0]->datum_meta_.cs_type_,
+                                         out_type, num_str, res_datum))) {
+          LOG_WARN("common_string_double failed", K(ret), K(num_str));
+        }
+      }
+    }
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(string, int)
+struct ObStringIntBatchCast
+{
+  static const bool STRING_ARG = true;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    ObString in_str(in.len_, in.ptr_);
+    const bool is_str_int_cast = true;
+    OZ(common_string_int(expr, expr.extra_, in_str, is_str_int_cast, res_datum));
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(string, number)
+struct ObStringNumberBatchCast
+{
+  static const bool STRING_ARG = true;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    number::ObNumber nmb;
+    ObNumStackOnceAlloc tmp_alloc;
+    OZ(common_string_number(expr, ObString(in.len_, in.ptr_), tmp_alloc, nmb));
+    OX(res_datum.set_number(nmb));
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(string, datetime)
+struct ObStringDatetimeBatchCast
+{
+  static const bool STRING_ARG = true;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &ctx, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    OZ(common_string_datetime(expr, ObString(in.len_, in.ptr_), ctx, res_datum));
+    return ret;
+  }
+};
+
+// same with CAST_FUNC_NAME(datetime, datetime)
+struct ObDatetimeDatetimeBatchCast
+{
+  static const bool STRING_ARG = false;
+  static OB_INLINE int cast(const ObExpr &expr, ObEvalCtx &ctx, const ObDatum &in,
+                            ObDatum &res_datum)
+  {
+    int ret = OB_SUCCESS;
+    GET_SESSION()
+    {
+      int64_t in_val = in.get_int();
+      int64_t out_val = in_val;
+      ObObjType in_type = expr.args_[0]->datum_meta_.type_;
+      ObObjType out_type = expr.datum_meta_.type_;
+      if (ObDateTimeType == in_type && ObTimestampType == out_type) {
+        ret = ObTimeConverter::datetime_to_timestamp(in_val,
+                                                     session->get_timezone_info(),
+                                                     out_val);
+        ret = OB_ERR_UNEXPECTED_TZ_TRANSITION == ret ? OB_INVALID_DATE_VALUE : ret;
+      } else if (ObTimestampType == in_type && ObDateTimeType == out_type) {
+        ret = ObTimeConverter::timestamp_to_datetime(out_val,
+                                                     session->get_timezone_info(),
+                                                     out_val);
+      }
+      if (OB_FAIL(ret)) {
+      } else {
+        res_datum.set_datetime(out_val);
+      }
+    }
+    return ret;
+  }
+};
+
+CAST_BATCH_FUNC_NAME(int, number)
+{
+  return batch_cast_kernel<ObIntNumberBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(number, int)
+{
+  return batch_cast_kernel<ObNumberIntBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(number, double)
+{
+  return batch_cast_kernel<ObNumberDoubleBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(string, int)
+{
+  return batch_cast_kernel<ObStringIntBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(string, number)
+{
+  return batch_cast_kernel<ObStringNumberBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(string, datetime)
+{
+  return batch_cast_kernel<ObStringDatetimeBatchCast>(expr, ctx, skip, batch_size);
+}
+
+CAST_BATCH_FUNC_NAME(datetime, datetime)
+{
+  return batch_cast_kernel<ObDatetimeDatetimeBatchCast>(expr, ctx, skip, batch_size);
+}
+
 CAST_FUNC_NAME(int, int)
 {
   EVAL_ARG()
@@ -9484,6 +9772,27 @@ int ObDatumCast::get_implicit_cast_function(const ObObjType in_type,
   return ret;
 }
 
+ObExpr::EvalBatchFunc ObDatumCast::get_cast_batch_function(const ObExpr::EvalFunc eval_func)
+{
+  ObExpr::EvalBatchFunc eval_batch_func = cast_eval_arg_batch;
+  if (int_number == eval_func) {
+    eval_batch_func = int_number_batch;
+  } else if (number_int == eval_func) {
+    eval_batch_func = number_int_batch;
+  } else if (number_double == eval_func) {
+    eval_batch_func = number_double_batch;
+  } else if (string_int == eval_func) {
+    eval_batch_func = string_int_batch;
+  } else if (string_number == eval_func) {
+    eval_batch_func = string_number_batch;
+  } else if (string_datetime == eval_func) {
+    eval_batch_func = string_datetime_batch;
+  } else if (datetime_datetime == eval_func) {
+    eval_batch_func = datetime_datetime_batch;
+  }
+  return eval_batch_func;
+}
+
 int ObDatumCast::choose_cast_function(const ObObjType in_type,
                                       const ObCollationType in_cs_type,
                                       const ObObjType out_type,
@@ -9538,9 +9847,8 @@ int ObDatumCast::choose_cast_function(const ObObjType in_type,
     }
   }
   if (OB_SUCC(ret)) {
-    // TODO:@xiaofeng.lby, need to modify cast expr in batch mode
-    // cast in batch mode will degrade into single row mode now
-    rt_expr.eval_batch_func_ = cast_eval_arg_batch;
+    // cast without batch kernel degrades into single row mode
+    rt_expr.eval_batch_func_ = get_cast_batch_function(rt_expr.eval_func_);
   }
   LOG_DEBUG("in choose_cast_function", K(ret), K(in_type), K(out_type),
       K(in_cs_type), K(out_cs_type), K(CM_IS_EXPLICIT_CAST(cast_mode)),
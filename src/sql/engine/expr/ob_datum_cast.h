@@ -129,6 +129,8 @@ public:
                                   const int64_t cast_mode,
                                   common::ObIAllocator &allocator,
                                   ObExpr &rt_expr);
+  // get batch cast kernel of the per-row cast function, cast_eval_arg_batch() if not exist.
+  static ObExpr::EvalBatchFunc get_cast_batch_function(const ObExpr::EvalFunc eval_func);
   static int get_enumset_cast_function(const common::ObObjTypeClass in_tc,
                                        const common::ObObjType out_type,
                                        ObExpr::EvalEnumSetFunc &eval_func);
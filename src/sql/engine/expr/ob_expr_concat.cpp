@@ -308,6 +308,7 @@ int ObExprConcat::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &expr) const
   }
   if (OB_SUCC(ret)) {
     expr.eval_func_ = &eval_concat;
+    expr.eval_batch_func_ = &eval_concat_batch;
   }
   return ret;
 }
@@ -317,66 +318,102 @@ int ObExprConcat::eval_concat(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_
   int ret = OB_SUCCESS;
   if (OB_FAIL(expr.eval_param_value(ctx))) {
     LOG_WARN("evaluate parameters values failed", K(ret));
-  } else {
-    ObDatum *first_not_null = NULL;
-    int64_t null_cnt = 0;
-    int64_t res_len = 0;
+  } else if (OB_FAIL(concat_datums(expr, ctx, get_max_res_len(expr), ctx.get_batch_idx(),
+                                   expr_datum))) {
+    LOG_WARN("concat datums failed", K(ret));
+  }
+  return ret;
+}
 
-    for (int64_t i = 0; i < expr.arg_cnt_; i++) {
-      ObDatum &v = expr.locate_param_datum(ctx, i);
-      if (v.is_null()) {
-        null_cnt += 1;
-      } else {
-        res_len += v.len_;
-        if (NULL == first_not_null) {
-          first_not_null = &v;
-        }
+int ObExprConcat::eval_concat_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                    const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
+    LOG_WARN("evaluate parameters values failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    const int64_t max_len = get_max_res_len(expr);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
       }
+      if (OB_FAIL(concat_datums(expr, ctx, max_len, i, res[i]))) {
+        LOG_WARN("concat datums failed", K(ret), K(i));
+      }
+      eval_flags.set(i);
     }
-    int64_t max_len = 0;
-    if (is_mysql_mode()) {
-      max_len = OB_MAX_VARCHAR_LENGTH;
-    } else if (expr.is_called_in_sql_) { // SQL in oracle mode
-      max_len = OB_MAX_ORACLE_VARCHAR_LENGTH;
-    } else { // PL in oracle mode
-      const int64_t concat_res_max_len_in_pl = 65535;
-      max_len = concat_res_max_len_in_pl;
-    }
-    if (ob_is_text_tc(expr.datum_meta_.type_)) {
-      // FIXME bin.lb: mysql mode can not reach here, since result type is always varchar.
-      // Seem to be a bug: https://work.aone.alibaba-inc.com/issue/24653475
-      max_len = OB_MAX_PACKET_LENGTH;
+  }
+  return ret;
+}
+
+int64_t ObExprConcat::get_max_res_len(const ObExpr &expr)
+{
+  int64_t max_len = 0;
+  if (is_mysql_mode()) {
+    max_len = OB_MAX_VARCHAR_LENGTH;
+  } else if (expr.is_called_in_sql_) { // SQL in oracle mode
+    max_len = OB_MAX_ORACLE_VARCHAR_LENGTH;
+  } else { // PL in oracle mode
+    const int64_t concat_res_max_len_in_pl = 65535;
+    max_len = concat_res_max_len_in_pl;
+  }
+  if (ob_is_text_tc(expr.datum_meta_.type_)) {
+    // FIXME bin.lb: mysql mode can not reach here, since result type is always varchar.
+    // Seem to be a bug: https://work.aone.alibaba-inc.com/issue/24653475
+    max_len = OB_MAX_PACKET_LENGTH;
+  }
+  return max_len;
+}
+
+int ObExprConcat::concat_datums(const ObExpr &expr, ObEvalCtx &ctx, const int64_t max_len,
+                                const int64_t batch_idx, ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *first_not_null = NULL;
+  int64_t null_cnt = 0;
+  int64_t res_len = 0;
+
+  for (int64_t i = 0; i < expr.arg_cnt_; i++) {
+    ObDatum &v = expr.args_[i]->locate_expr_datum(ctx, batch_idx);
+    if (v.is_null()) {
+      null_cnt += 1;
+    } else {
+      res_len += v.len_;
+      if (NULL == first_not_null) {
+        first_not_null = &v;
+      }
     }
-    if (res_len > max_len) {
-      expr_datum.set_null();
-      ret = OB_SIZE_OVERFLOW;
-      LOG_WARN("size overflow", K(ret), K(res_len), K(max_len));
-    } else if (expr.arg_cnt_ == null_cnt
-            || (!lib::is_oracle_mode() && null_cnt > 0)) {
-      // input are all null or has null in mysql mode
-      expr_datum.set_null();
-    } else if (expr.arg_cnt_ - null_cnt == 1) {
-      // only one valid input, shadow copy
-      expr_datum.set_datum(*first_not_null);
+  }
+  if (res_len > max_len) {
+    expr_datum.set_null();
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("size overflow", K(ret), K(res_len), K(max_len));
+  } else if (expr.arg_cnt_ == null_cnt
+          || (!lib::is_oracle_mode() && null_cnt > 0)) {
+    // input are all null or has null in mysql mode
+    expr_datum.set_null();
+  } else if (expr.arg_cnt_ - null_cnt == 1) {
+    // only one valid input, shadow copy
+    expr_datum.set_datum(*first_not_null);
+  } else {
+    char *buf = expr.get_str_res_mem(ctx, res_len, batch_idx);
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K(res_len));
     } else {
-      char *buf = expr.get_str_res_mem(ctx, res_len);
-      if (OB_ISNULL(buf)) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("allocate memory failed", K(ret), K(res_len));
-      } else {
-        int64_t off = 0;
-        for (int64_t i = 0; i < expr.arg_cnt_; i++) {
-          ObDatum &v = expr.locate_param_datum(ctx, i);
-          if (!v.is_null()) {
-            MEMCPY(buf + off, v.ptr_, v.len_);
-            off += v.len_;
-          }
+      int64_t off = 0;
+      for (int64_t i = 0; i < expr.arg_cnt_; i++) {
+        ObDatum &v = expr.args_[i]->locate_expr_datum(ctx, batch_idx);
+        if (!v.is_null()) {
+          MEMCPY(buf + off, v.ptr_, v.len_);
+          off += v.len_;
         }
-        OB_ASSERT(off == res_len);
       }
-      expr_datum.set_string(buf, res_len);
+      OB_ASSERT(off == res_len);
     }
-
+    expr_datum.set_string(buf, res_len);
   }
   return ret;
 }
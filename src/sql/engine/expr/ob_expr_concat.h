@@ -59,8 +59,14 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_concat(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int eval_concat_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                               const ObBitVector &skip, const int64_t batch_size);
 
 private:
+  static int64_t get_max_res_len(const ObExpr &expr);
+  // concat parameters of row %batch_idx, parameters must be evaluated.
+  static int concat_datums(const ObExpr &expr, ObEvalCtx &ctx, const int64_t max_len,
+                           const int64_t batch_idx, ObDatum &expr_datum);
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObExprConcat);
 };
@@ -340,6 +340,13 @@ extern int calc_convert_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_da
 extern int calc_translate_using_expr(const ObExpr &, ObEvalCtx &, ObDatum &);
 extern int eval_question_mark_func(EVAL_FUNC_ARG_DECL);
 extern int cast_eval_arg_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int int_number_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int number_int_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int number_double_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int string_int_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int string_number_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int string_datetime_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+extern int datetime_datetime_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
 extern int eval_batch_ceil_floor(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
 extern int eval_assign_question_mark_func(EVAL_FUNC_ARG_DECL);
 extern int calc_timestamp_to_scn_expr(const ObExpr &, ObEvalCtx &, ObDatum &);
@@ -964,7 +971,27 @@ static ObExpr::EvalBatchFunc g_expr_eval_batch_functions[] = {
   ObExprInstrb::calc_instrb_expr_batch,                               /* 94 */
   ObExprNaNvl::eval_nanvl_batch,                                      /* 95 */
   ObExprNvlUtil::calc_nvl_expr_batch,                                 /* 96 */
-  ObExprNvl2Oracle::calc_nvl2_oracle_expr_batch                       /* 97 */
+  ObExprNvl2Oracle::calc_nvl2_oracle_expr_batch,                      /* 97 */
+  ObExprLength::calc_oracle_mode_batch,                               /* 98 */
+  ObExprLength::calc_mysql_mode_batch,                                /* 99 */
+  ObExprLower::calc_lower_batch,                                      /* 100 */
+  ObExprUpper::calc_upper_batch,                                      /* 101 */
+  ObExprConcat::eval_concat_batch,                                    /* 102 */
+  ObExprTrim::eval_trim_batch,                                        /* 103 */
+  ObExprReplace::eval_replace_batch,                                  /* 104 */
+  ObExprInstr::calc_mysql_instr_expr_batch,                           /* 105 */
+  ObExprRegexpLike::eval_regexp_like_batch,                           /* 106 */
+  ObExprRegexp::eval_regexp_batch,                                    /* 107 */
+  int_number_batch,                                                   /* 108 */
+  number_int_batch,                                                   /* 109 */
+  number_double_batch,                                                /* 110 */
+  string_int_batch,                                                   /* 111 */
+  string_number_batch,                                                /* 112 */
+  string_datetime_batch,                                              /* 113 */
+  datetime_datetime_batch,                                            /* 114 */
+  ObExprJsonExtract::eval_json_extract_batch,                         /* 115 */
+  ObExprJsonValue::eval_json_value_batch,                             /* 116 */
+  ObExprJsonUnquote::eval_json_unquote_batch                          /* 117 */
 };
 
 REG_SER_FUNC_ARRAY(OB_SFA_SQL_EXPR_EVAL,
@@ -11,6 +11,7 @@
  */
 
 #define USING_LOG_PREFIX SQL_ENG
+#include <string.h>
 #include "lib/container/ob_array.h"
 #include "lib/container/ob_array_iterator.h"
 #include "lib/container/ob_fixed_array.h"
@@ -57,9 +58,70 @@ int ObExprInstr::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
   UNUSED(op_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_mysql_instr_expr;
+  rt_expr.eval_batch_func_ = calc_mysql_instr_expr_batch;
   return OB_SUCCESS;
 }
 
+int ObExprInstr::calc_mysql_instr_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                             const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObCollationType calc_cs_type = CS_TYPE_INVALID;
+  if (OB_UNLIKELY(2 != expr.arg_cnt_) || OB_ISNULL(expr.args_) ||
+      OB_ISNULL(expr.args_[0]) || OB_ISNULL(expr.args_[1])) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid expr", K(ret), K(expr));
+  } else if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval arg 0 failed", K(ret));
+  } else if (OB_FAIL(expr.args_[1]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval arg 1 failed", K(ret));
+  } else if (OB_FAIL(get_calc_cs_type(expr, calc_cs_type))) {
+    LOG_WARN("get_calc_cs_type failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector ori_datums = expr.args_[0]->locate_expr_datumvector(ctx);
+    ObDatumVector sub_datums = expr.args_[1]->locate_expr_datumvector(ctx);
+    // Byte matching is character matching for binary and utf8mb4_bin, search with memmem()
+    // which is vectorized by libc. utf8mb4 is self-synchronizing, a byte match of valid
+    // utf8mb4 strings always starts at a character boundary.
+    const bool byte_search = CS_TYPE_BINARY == calc_cs_type
+                             || CS_TYPE_UTF8MB4_BIN == calc_cs_type;
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      ObDatum *ori = ori_datums.at(i);
+      ObDatum *sub = sub_datums.at(i);
+      if (ori->is_null() || sub->is_null()) {
+        res[i].set_null();
+      } else if (byte_search) {
+        int64_t idx = 0;
+        if (0 == sub->len_) {
+          idx = 1;
+        } else if (sub->len_ <= ori->len_) {
+          const char *found = static_cast<const char *>(memmem(ori->ptr_, ori->len_,
+                                                               sub->ptr_, sub->len_));
+          if (NULL == found) {
+            idx = 0;
+          } else if (CS_TYPE_BINARY == calc_cs_type) {
+            idx = found - ori->ptr_ + 1;
+          } else {
+            idx = ObCharset::strlen_char(calc_cs_type, ori->ptr_, found - ori->ptr_) + 1;
+          }
+        }
+        res[i].set_int(idx);
+      } else {
+        uint32_t idx = ObCharset::locate(calc_cs_type, ori->ptr_, ori->len_,
+                                         sub->ptr_, sub->len_, 1);
+        res[i].set_int(static_cast<int64_t>(idx));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
 /***** oracle ******/
 
 ObExprOracleInstr::ObExprOracleInstr(ObIAllocator &alloc)
@@ -26,6 +26,8 @@ public:
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                                ObExpr &rt_expr) const;
   static int calc_mysql_instr_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_mysql_instr_expr_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                         const ObBitVector &skip, const int64_t batch_size);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprInstr);
 };
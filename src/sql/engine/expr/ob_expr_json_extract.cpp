@@ -205,6 +205,12 @@ int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObD
   return ret;
 }
 
+int ObExprJsonExtract::eval_json_extract_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                               const ObBitVector &skip, const int64_t batch_size)
+{
+  return ObJsonExprHelper::eval_batch_by_row(expr, ctx, skip, batch_size, eval_json_extract);
+}
+
 int ObExprJsonExtract::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                                ObExpr &rt_expr) const
 {
@@ -214,6 +220,7 @@ int ObExprJsonExtract::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_ex
       rt_expr.eval_func_ = eval_json_extract_null;
   } else {
       rt_expr.eval_func_ = eval_json_extract;
+      rt_expr.eval_batch_func_ = eval_json_extract_batch;
   }
   return OB_SUCCESS;
 }
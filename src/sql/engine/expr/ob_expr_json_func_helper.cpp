@@ -271,6 +271,33 @@ ObJsonPathCache* ObJsonExprHelper::get_path_cache_ctx(const uint64_t& id, ObExec
   return (cache_ctx == NULL) ? NULL : cache_ctx->get_path_cache();
 }
 
+int ObJsonExprHelper::eval_batch_by_row(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size,
+                                        ObExpr::EvalFunc row_eval)
+{
+  INIT_SUCC(ret);
+  if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
+    LOG_WARN("eval json args in batch failed", K(ret));
+  } else {
+    ObDatum *results = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      if (OB_FAIL(row_eval(expr, ctx, results[i]))) {
+        LOG_WARN("eval json expr failed", K(ret), K(i));
+      } else {
+        eval_flags.set(i);
+      }
+    }
+  }
+  return ret;
+}
+
 int ObJsonExprHelper::find_and_add_cache(ObJsonPathCache* path_cache, ObJsonPath*& res_path,
                                          ObString& path_str, int arg_idx, bool enable_wildcard)
 {
@@ -114,6 +114,20 @@ public:
 
   static ObJsonPathCache* get_path_cache_ctx(const uint64_t& id, ObExecContext *exec_ctx);
 
+  /*
+  evaluate json expression in batch, arguments are evaluated in batch first, then
+  the row eval function is called for each active row.
+  @param[in]  expr        the json expression
+  @param[in]  ctx         the eval context
+  @param[in]  skip        rows to skip
+  @param[in]  batch_size  batch size
+  @param[in]  row_eval    the row eval function of expr
+  @return Returns OB_SUCCESS on success, error code otherwise.
+  */
+  static int eval_batch_by_row(const ObExpr &expr, ObEvalCtx &ctx,
+                               const ObBitVector &skip, const int64_t batch_size,
+                               ObExpr::EvalFunc row_eval);
+
   static int is_json_zero(const ObString& data, int& result);
   
   /*
@@ -138,12 +138,20 @@ int ObExprJsonUnquote::eval_json_unquote(const ObExpr &expr, ObEvalCtx &ctx, ObD
   return ret;
 }
 
+// column->>path is json_unquote(json_extract(column, path)), evaluate it in batch too.
+int ObExprJsonUnquote::eval_json_unquote_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                               const ObBitVector &skip, const int64_t batch_size)
+{
+  return ObJsonExprHelper::eval_batch_by_row(expr, ctx, skip, batch_size, eval_json_unquote);
+}
+
 int ObExprJsonUnquote::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                                ObExpr &rt_expr) const
 {
   UNUSED(expr_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = eval_json_unquote;
+  rt_expr.eval_batch_func_ = eval_json_unquote_batch;
   return OB_SUCCESS;
 }
 
@@ -320,11 +320,18 @@ int ObExprJsonValue::eval_json_value(const ObExpr &expr, ObEvalCtx &ctx, ObDatum
   return ret;
 }
 
+int ObExprJsonValue::eval_json_value_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                           const ObBitVector &skip, const int64_t batch_size)
+{
+  return ObJsonExprHelper::eval_batch_by_row(expr, ctx, skip, batch_size, eval_json_value);
+}
+
 int ObExprJsonValue::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr, ObExpr &rt_expr) const
 {
   UNUSED(expr_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = eval_json_value;
+  rt_expr.eval_batch_func_ = eval_json_value_batch;
   return OB_SUCCESS;
 }
 
@@ -36,6 +36,8 @@ public:
                                 common::ObExprTypeCtx& type_ctx)
                                 const override;
   static int eval_json_value(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
+  static int eval_json_value_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                   const ObBitVector &skip, const int64_t batch_size);
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual common::ObCastMode get_cast_mode() const { return CM_ERROR_ON_SCALE_OVER;}
@@ -87,9 +87,11 @@ int ObExprLength::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr, ObE
       rt_expr.eval_func_ = ObExprLength::calc_null;
     } else if (lib::is_oracle_mode()) {
       rt_expr.eval_func_ = ObExprLength::calc_oracle_mode;
+      rt_expr.eval_batch_func_ = ObExprLength::calc_oracle_mode_batch;
     } else {
       CK(ObVarcharType == text_type);
       rt_expr.eval_func_ = ObExprLength::calc_mysql_mode;
+      rt_expr.eval_batch_func_ = ObExprLength::calc_mysql_mode_batch;
     }
   }
   return ret;
@@ -138,5 +140,75 @@ int ObExprLength::calc_mysql_mode(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &e
   return ret;
 }
 
+
+int ObExprLength::calc_oracle_mode_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                         const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval param value failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_datums = expr.args_[0]->locate_expr_datumvector(ctx);
+    const ObCollationType cs_type = expr.args_[0]->datum_meta_.cs_type_;
+    // ASCII strings of ASCII compatible charsets have one byte per character.
+    const bool ascii_compatible = ObExprUtil::is_ascii_casemap_collation(cs_type);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      ObDatum *text_datum = text_datums.at(i);
+      if (text_datum->is_null()) {
+        res[i].set_null();
+      } else {
+        ObString m_text = text_datum->get_string();
+        size_t c_len = 0;
+        if (ascii_compatible && ObExprUtil::is_ascii_str(m_text.ptr(), m_text.length())) {
+          c_len = m_text.length();
+        } else {
+          c_len = ObCharset::strlen_char(cs_type, m_text.ptr(),
+                                         static_cast<int64_t>(m_text.length()));
+        }
+        ObNumStackOnceAlloc tmp_alloc;
+        number::ObNumber num;
+        if (OB_FAIL(num.from(static_cast<int64_t>(c_len), tmp_alloc))) {
+          LOG_WARN("copy number fail", K(ret));
+        } else {
+          res[i].set_number(num);
+        }
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
+int ObExprLength::calc_mysql_mode_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval param value failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_datums = expr.args_[0]->locate_expr_datumvector(ctx);
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      ObDatum *text_datum = text_datums.at(i);
+      if (text_datum->is_null()) {
+        res[i].set_null();
+      } else {
+        res[i].set_int(static_cast<int64_t>(text_datum->len_));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
 }
 }
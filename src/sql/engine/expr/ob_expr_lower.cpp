@@ -14,6 +14,7 @@
 
 #include <string.h>
 #include "sql/engine/expr/ob_expr_lower.h"
+#include "sql/engine/expr/ob_expr_util.h"
 
 #include "share/object/ob_obj_cast.h"
 #include "objit/common/ob_item_type.h"
@@ -265,6 +266,7 @@ int ObExprLower::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("lower expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprLower::calc_lower;
+    rt_expr.eval_batch_func_ = ObExprLower::calc_lower_batch;
   }
   return ret;
 }
@@ -278,6 +280,52 @@ int ObExprUpper::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("upper expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprUpper::calc_upper;
+    rt_expr.eval_batch_func_ = ObExprUpper::calc_upper_batch;
+  }
+  return ret;
+}
+
+int ObExprLowerUpper::calc_case_str(const ObExpr &expr, ObEvalCtx &ctx,
+                                    const ObString &m_text, const bool lower,
+                                    const ObCollationType cs_type, const int64_t datum_idx,
+                                    ObString &str_result)
+{
+  int ret = OB_SUCCESS;
+  if (m_text.empty()) {
+    str_result.reset();
+  } else {
+    int32_t buf_len = m_text.length();
+    if (OB_UNLIKELY(!ObCharset::is_valid_collation(cs_type))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("charset is null", K(ret), K(cs_type));
+    } else {
+      buf_len *= (lower ? ObCharset::get_charset(cs_type)->casedn_multiply
+                        : ObCharset::get_charset(cs_type)->caseup_multiply);
+    }
+    if (OB_SUCC(ret)) {
+      char *buf = expr.get_str_res_mem(ctx, buf_len, datum_idx);
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_ERROR("alloc memory failed", "size", buf_len);
+      } else if (ObExprUtil::is_ascii_casemap_collation(cs_type)
+                 && ObExprUtil::ascii_casemap(m_text.ptr(), m_text.length(), buf, lower)) {
+        // ASCII fast path, the result has the same length as the input.
+        str_result.assign(buf, m_text.length());
+      } else {
+        MEMCPY(buf, m_text.ptr(), m_text.length());
+        int32_t out_len = 0;
+        //gb18030 可能会膨胀，src_str和dst_str要转入不同的buf，其他字符集可以传相同的
+        char *src_str = (buf_len != m_text.length()) ? const_cast<char*>(m_text.ptr()) : buf;
+        if (lower) {
+          out_len = static_cast<int32_t>(ObCharset::casedn(cs_type,
+                                              src_str, m_text.length(), buf, buf_len));
+        } else {
+          out_len = static_cast<int32_t>(ObCharset::caseup(cs_type,
+                                              src_str, m_text.length(), buf, buf_len));
+        }
+        str_result.assign(buf, static_cast<int32_t>(out_len));
+      }
+    }
   }
   return ret;
 }
@@ -292,45 +340,47 @@ int ObExprLowerUpper::calc_common(const ObExpr &expr, ObEvalCtx &ctx,
   } else if (text_datum->is_null()) {
     expr_datum.set_null();
   } else {
-    ObString m_text = text_datum->get_string();
     if (cs_type == CS_TYPE_INVALID) {
       cs_type = expr.datum_meta_.cs_type_;
     }
     ObString str_result;
-    if (m_text.empty()) {
-      str_result.reset();
+    if (OB_FAIL(calc_case_str(expr, ctx, text_datum->get_string(), lower, cs_type,
+                              expr.get_datum_idx(ctx), str_result))) {
+      LOG_WARN("calc case string failed", K(ret));
     } else {
-      int32_t buf_len = m_text.length();
-      if (OB_UNLIKELY(!ObCharset::is_valid_collation(cs_type))) {
-        ret = OB_ERR_UNEXPECTED;
-        LOG_WARN("charset is null", K(ret), K(cs_type));
-      } else {
-        buf_len *= (lower ? ObCharset::get_charset(cs_type)->casedn_multiply
-                          : ObCharset::get_charset(cs_type)->caseup_multiply);
+      expr_datum.set_string(str_result);
+    }
+  }
+  return ret;
+}
+
+int ObExprLowerUpper::calc_common_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size,
+                                        const bool lower)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval param value failed", K(ret));
+  } else {
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_datums = expr.args_[0]->locate_expr_datumvector(ctx);
+    const ObCollationType cs_type = expr.datum_meta_.cs_type_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
       }
-      if (OB_SUCC(ret)) {
-        char *buf = expr.get_str_res_mem(ctx, buf_len);
-        if (OB_ISNULL(buf)) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_ERROR("alloc memory failed", "size", buf_len);
-        } else {
-          MEMCPY(buf, m_text.ptr(), m_text.length());
-          int32_t out_len = 0;
-          //gb18030 可能会膨胀，src_str和dst_str要转入不同的buf，其他字符集可以传相同的
-          char *src_str = (buf_len != m_text.length()) ? const_cast<char*>(m_text.ptr()) : buf;
-          if (lower) {
-            out_len = static_cast<int32_t>(ObCharset::casedn(cs_type,
-                                                src_str, m_text.length(), buf, buf_len));
-          } else {
-            out_len = static_cast<int32_t>(ObCharset::caseup(cs_type,
-                                                src_str, m_text.length(), buf, buf_len));
-          }
-          str_result.assign(buf, static_cast<int32_t>(out_len));
-        }
+      ObDatum *text_datum = text_datums.at(i);
+      ObString str_result;
+      if (text_datum->is_null()) {
+        res[i].set_null();
+      } else if (OB_FAIL(calc_case_str(expr, ctx, text_datum->get_string(), lower, cs_type,
+                                       i, str_result))) {
+        LOG_WARN("calc case string failed", K(ret));
+      } else {
+        res[i].set_string(str_result);
       }
-    }
-    if (OB_SUCC(ret)) {
-      expr_datum.set_string(str_result);
+      eval_flags.set(i);
     }
   }
   return ret;
@@ -391,6 +441,18 @@ int ObExprUpper::calc_upper(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_da
   return calc_common(expr, ctx, expr_datum, false, CS_TYPE_INVALID);
 }
 
+int ObExprLower::calc_lower_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                  const ObBitVector &skip, const int64_t batch_size)
+{
+  return calc_common_batch(expr, ctx, skip, batch_size, true);
+}
+
+int ObExprUpper::calc_upper_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                  const ObBitVector &skip, const int64_t batch_size)
+{
+  return calc_common_batch(expr, ctx, skip, batch_size, false);
+}
+
 int ObExprNlsLower::calc(const ObCollationType cs_type, char *src, int32_t src_len,
                          char *dst, int32_t dst_len, int32_t &out_len) const
 {
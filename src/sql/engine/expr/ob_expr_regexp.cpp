@@ -128,64 +128,92 @@ int ObExprRegexp::cg_expr(ObExprCGCtx &, const ObRawExpr &raw_expr, ObExpr &rt_e
      const bool const_pattern = pattern->is_const_expr();
      rt_expr.extra_ = (!const_text && const_pattern) ? 1 : 0;
      rt_expr.eval_func_ = eval_regexp;
+     rt_expr.eval_batch_func_ = eval_regexp_batch;
      LOG_DEBUG("regexp expr cg", K(const_text), K(const_pattern), K(rt_expr.extra_));
   }
   return ret;
 }
 
-int ObExprRegexp::eval_regexp(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+int ObExprRegexp::calc_regexp(const ObExpr &expr, ObEvalCtx &ctx,
+                              const ObDatum &text, const ObDatum &pattern,
+                              ObExprRegexContext *reusable_ctx, ObDatum &expr_datum)
 {
   int ret = OB_SUCCESS;
-  ObDatum *text = NULL;
-  ObDatum *pattern = NULL;
-  if (OB_FAIL(expr.eval_param_value(ctx, text, pattern))) {
-    LOG_WARN("evaluate parameters failed", K(ret));
-  } else if (text->is_null() || pattern->is_null()) {
+  if (text.is_null() || pattern.is_null()) {
     expr_datum.set_null();
-  } else if (0 == pattern->len_) {
+  } else if (0 == pattern.len_) {
     ret = OB_ERR_REGEXP_ERROR;
     LOG_WARN("empty regex expression", K(ret));
     expr_datum.set_null();
   } else {
-    const bool reusable = (0 != expr.extra_)
-        && ObExpr::INVALID_EXP_CTX_ID != expr.expr_ctx_id_;
+    const bool reusable = (NULL != reusable_ctx);
     ObExprRegexContext local_regex_ctx;
-    ObExprRegexContext *regex_ctx = &local_regex_ctx;
-    if (reusable) {
-      if (NULL == (regex_ctx = static_cast<ObExprRegexContext *>(
-                  ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
-        if (OB_FAIL(ctx.exec_ctx_.create_expr_op_ctx(expr.expr_ctx_id_, regex_ctx))) {
-          LOG_WARN("create expr regex context failed", K(ret), K(expr));
-        } else if (OB_ISNULL(regex_ctx)) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("NULL context returned", K(ret));
-        }
-      }
+    ObExprRegexContext *regex_ctx = reusable ? reusable_ctx : &local_regex_ctx;
+    ObEvalCtx::TempAllocGuard alloc_guard(ctx);
+    ObIAllocator &tmp_alloc = alloc_guard.get_allocator();
+    const int64_t start_off = 0;
+    bool match = false;
+    int flags = ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_)
+        ? OB_REG_EXTENDED | OB_REG_NOSUB
+        : OB_REG_EXTENDED | OB_REG_NOSUB | OB_REG_ICASE;
+    if (OB_FAIL(regex_ctx->init(
+                pattern.get_string(), flags,
+                reusable ? ctx.exec_ctx_.get_allocator() : tmp_alloc,
+                reusable))) {
+      LOG_WARN("init regex context failed",
+               K(ret), K(pattern.get_string()));
+    } else if (OB_FAIL(regex_ctx->match(text.get_string(), start_off, match, tmp_alloc))) {
+      LOG_WARN("regex match failed", K(ret));
+    } else {
+      expr_datum.set_int32(match);
     }
-    if (OB_SUCC(ret)) {
-      ObEvalCtx::TempAllocGuard alloc_guard(ctx);
-      ObIAllocator &tmp_alloc = alloc_guard.get_allocator();
-      const int64_t start_off = 0;
-      bool match = false;
-      int flags = ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_)
-          ? OB_REG_EXTENDED | OB_REG_NOSUB
-          : OB_REG_EXTENDED | OB_REG_NOSUB | OB_REG_ICASE;
-      if (OB_FAIL(regex_ctx->init(
-                  pattern->get_string(), flags,
-                  reusable ? ctx.exec_ctx_.get_allocator() : tmp_alloc,
-                  reusable))) {
-        LOG_WARN("init regex context failed",
-                 K(ret), K(pattern->get_string()));
-      } else if (OB_FAIL(regex_ctx->match(text->get_string(), start_off, match, tmp_alloc))) {
-        LOG_WARN("regex match failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexp::eval_regexp(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *text = NULL;
+  ObDatum *pattern = NULL;
+  ObExprRegexContext *regex_ctx = NULL;
+  if (OB_FAIL(expr.eval_param_value(ctx, text, pattern))) {
+    LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(ObExprRegexContext::get_reusable_ctx(expr, ctx, regex_ctx))) {
+    LOG_WARN("get regex context failed", K(ret));
+  } else if (OB_FAIL(calc_regexp(expr, ctx, *text, *pattern, regex_ctx, expr_datum))) {
+    LOG_WARN("calc regexp failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexp::eval_regexp_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                    const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObExprRegexContext *regex_ctx = NULL;
+  if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
+    LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(ObExprRegexContext::get_reusable_ctx(expr, ctx, regex_ctx))) {
+    LOG_WARN("get regex context failed", K(ret));
+  } else {
+    ObDatum *results = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_array = expr.args_[0]->locate_expr_datumvector(ctx);
+    ObDatumVector pattern_array = expr.args_[1]->locate_expr_datumvector(ctx);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      } else if (OB_FAIL(calc_regexp(expr, ctx, *text_array.at(i), *pattern_array.at(i),
+                                     regex_ctx, results[i]))) {
+        LOG_WARN("calc regexp failed", K(ret), K(i));
       } else {
-        expr_datum.set_int32(match);
+        eval_flags.set(i);
       }
     }
   }
   return ret;
 }
 
-
 }
 }
@@ -52,8 +52,13 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_regexp(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int eval_regexp_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                               const ObBitVector &skip, const int64_t batch_size);
 private:
   inline int need_fast_calc(common::ObExprCtx &expr_ctx, bool &result) const;
+  static int calc_regexp(const ObExpr &expr, ObEvalCtx &ctx,
+                         const ObDatum &text, const ObDatum &pattern,
+                         ObExprRegexContext *reusable_ctx, ObDatum &expr_datum);
 private:
   int16_t regexp_idx_; // idx of posix_regexp_list_ in plan ctx, for regexp operator
   bool pattern_is_const_;
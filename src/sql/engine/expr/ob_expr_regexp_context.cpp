@@ -19,17 +19,25 @@
 #include "lib/charset/ob_charset.h"
 #include "sql/engine/expr/ob_expr_regexp_context.h"
 #include "sql/engine/expr/ob_expr_util.h"
+#include "sql/engine/ob_exec_context.h"
 namespace oceanbase
 {
 using namespace common;
 namespace sql
 {
 
+static inline char ascii_tolower(const char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
 ObExprRegexContext::ObExprRegexContext()
   : ObExprOperatorCtx(),
     inited_(false),
     reg_(),
-    cflags_(0)
+    cflags_(0),
+    must_literal_(),
+    must_literal_icase_(false)
 {
 }
 
@@ -81,6 +89,8 @@ int ObExprRegexContext::init(const ObString &origin_pattern,
       reset_reg();
       inited_ = false;
       cflags_ = 0;
+      must_literal_.reset();
+      must_literal_icase_ = false;
     }
     pattern_allocator_.prepare(string_buf);
     pattern_wc_allocator_.prepare(string_buf);
@@ -110,6 +120,7 @@ int ObExprRegexContext::init(const ObString &origin_pattern,
         destroy();
       } else {
         inited_ = true;
+        extract_must_literal();
       }
     }
   }
@@ -130,6 +141,8 @@ int ObExprRegexContext::match(const ObString &text,
   } else if (text.length() < 0 || (text.length() > 0 && OB_ISNULL(text.ptr()))) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid param", K(ret), K(text));
+  } else if (must_not_match(text)) {
+    is_match = false;
   } else {
     const static int64_t NMATCH = 1;
     ob_regmatch_t pmatch[NMATCH];
@@ -174,6 +187,8 @@ int ObExprRegexContext::substr(const ObString &text,
   if (OB_UNLIKELY(!inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("regexp context not inited yet", K(ret), K(this));
+  } else if (must_not_match(text)) {
+    /*do nothing*/
   } else if (reg_.re_nsub >= subexpr) {
     size_t nsub = reg_.re_nsub;
     ob_regmatch_t pmatch[nsub + 1];
@@ -254,6 +269,8 @@ int ObExprRegexContext::count_match_str(const ObString &text,
   if (OB_UNLIKELY(!inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("regexp context not inited yet", K(ret), K(this));
+  } else if (must_not_match(text)) {
+    /*do nothing*/
   } else if (reg_.re_nsub >= subexpr) {
     size_t nsub = reg_.re_nsub;
     ob_regmatch_t pmatch[nsub + 1];
@@ -324,6 +341,8 @@ int ObExprRegexContext::instr(const ObString &text,
   if (OB_UNLIKELY(!inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("regexp context not inited yet", K(ret), K(this));
+  } else if (must_not_match(text)) {
+    /*do nothing*/
   } else if (reg_.re_nsub >= subexpr) {
     size_t nsub = reg_.re_nsub;
     ob_regmatch_t pmatch[nsub + 1];
@@ -394,9 +413,13 @@ int ObExprRegexContext::like(const ObString &text,
   } else if (text.length() < 0 || (text.length() > 0 && OB_ISNULL(text.ptr()))) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid param, source text is null", K(ret), K(text));
+  } else if (must_not_match(text)) {
+    /*do nothing*/
   } else {
-    size_t nsub = reg_.re_nsub;
-    ob_regmatch_t pmatch[nsub + 1];
+    // Only whether it matches is needed, the end of match is needed to locate the next
+    // occurrence, submatches are never needed and expensive to dissect.
+    const size_t nmatch = occurrence > 1 ? 1 : 0;
+    ob_regmatch_t pmatch[1];
     int error = 0;
     int64_t tmp_start = 0;
     int64_t start = 0;
@@ -416,7 +439,7 @@ int ObExprRegexContext::like(const ObString &text,
           tmp_start = start;
           pmatch[0].rm_so = start;
           pmatch[0].rm_eo = wc_length;
-          error = ob_re_wexec((ob_regex_t *)&reg_, wc_text, wc_length, NULL, nsub+1, pmatch, 0);
+          error = ob_re_wexec((ob_regex_t *)&reg_, wc_text, wc_length, NULL, nmatch, pmatch, 0);
           if (OB_UNLIKELY(0 != error)) {
             if (OB_LIKELY(OB_REG_NOMATCH == error)) {
                LOG_TRACE("regex not match", K(ret));
@@ -834,7 +857,134 @@ void ObExprRegexContext::destroy()
     reset_reg();
     inited_ = false;
     cflags_ = 0;
+    must_literal_.reset();
+    must_literal_icase_ = false;
+  }
+}
+
+int ObExprRegexContext::get_reusable_ctx(const ObExpr &expr, ObEvalCtx &ctx,
+                                         ObExprRegexContext *&regexp_ctx)
+{
+  int ret = OB_SUCCESS;
+  regexp_ctx = NULL;
+  const bool reusable = (0 != expr.extra_) && ObExpr::INVALID_EXP_CTX_ID != expr.expr_ctx_id_;
+  if (reusable) {
+    if (NULL == (regexp_ctx = static_cast<ObExprRegexContext *>(
+                ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+      if (OB_FAIL(ctx.exec_ctx_.create_expr_op_ctx(expr.expr_ctx_id_, regexp_ctx))) {
+        LOG_WARN("create expr regex context failed", K(ret), K(expr));
+      } else if (OB_ISNULL(regexp_ctx)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("NULL context returned", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+void ObExprRegexContext::extract_must_literal()
+{
+  must_literal_.reset();
+  must_literal_icase_ = (0 != (cflags_ & OB_REG_ICASE));
+  const char *pat = pattern_.ptr();
+  const int64_t len = pattern_.length();
+  bool give_up = (cflags_ & (OB_REG_EXPANDED | OB_REG_QUOTE)) || len <= 0
+      // director "***" and embedded options "(?i)" are only allowed at the beginning
+      || '*' == pat[0] || (len > 1 && '(' == pat[0] && '?' == pat[1])
+      || NULL != memchr(pat, '|', len);
+  // Only literal runs out of any parentheses are mandatory. Stop at the first
+  // bracket expression or escape, they are too complex to be skipped safely.
+  int64_t depth = 0;
+  int64_t run_start = 0;
+  int64_t run_len = 0;
+  int64_t best_start = 0;
+  int64_t best_len = 0;
+  for (int64_t i = 0; !give_up && i <= len; ++i) {
+    const char c = i < len ? pat[i] : '\0';
+    bool end_run = true;
+    bool drop_last = false;
+    switch (c) {
+      case '\0':
+      case '[':
+      case '\\': give_up = true; break;
+      case '(': ++depth; break;
+      case ')': --depth; break;
+      case '.':
+      case '^':
+      case '$':
+      case '+': break;
+      case '*':
+      case '?': drop_last = true; break;
+      case '{': {
+        drop_last = true;
+        const char *close = static_cast<const char *>(memchr(pat + i, '}', len - i));
+        if (NULL == close) {
+          give_up = true;
+        } else {
+          i = close - pat;
+        }
+        break;
+      }
+      default: end_run = false; break;
+    }
+    if (!end_run) {
+      if (0 == depth) {
+        if (0 == run_len) {
+          run_start = i;
+        }
+        ++run_len;
+      }
+    } else {
+      if (drop_last) {
+        // the quantifier applies to the last (maybe multi-byte) character only.
+        while (run_len > 0 && 0x80 == (pat[run_start + run_len - 1] & 0xC0)) {
+          --run_len;
+        }
+        run_len = run_len > 0 ? run_len - 1 : 0;
+      }
+      if (run_len > best_len) {
+        best_start = run_start;
+        best_len = run_len;
+      }
+      run_len = 0;
+    }
+  }
+  if (best_len > 0 && must_literal_icase_) {
+    // only ascii case folding is done in must_not_match().
+    for (int64_t i = best_start; best_len > 0 && i < best_start + best_len; ++i) {
+      if (0 != (pat[i] & 0x80)) {
+        best_len = 0;
+      }
+    }
+  }
+  if (best_len > 0) {
+    must_literal_.assign_ptr(pat + best_start, static_cast<int32_t>(best_len));
+  }
+}
+
+bool ObExprRegexContext::must_not_match(const ObString &text) const
+{
+  bool bret = false;
+  const int64_t lit_len = must_literal_.length();
+  if (lit_len <= 0) {
+  } else if (text.length() < lit_len) {
+    bret = true;
+  } else if (!must_literal_icase_) {
+    bret = (NULL == memmem(text.ptr(), text.length(), must_literal_.ptr(), lit_len));
+  } else {
+    const char *lit = must_literal_.ptr();
+    const char *str = text.ptr();
+    const int64_t last = text.length() - lit_len;
+    bret = true;
+    for (int64_t i = 0; bret && i <= last; ++i) {
+      int64_t j = 0;
+      while (j < lit_len && ascii_tolower(str[i + j]) == ascii_tolower(lit[j])) {
+        ++j;
+      }
+      bret = (j != lit_len);
+    }
   }
+  return bret;
 }
 
 int ObExprRegexContext::pre_process_replace_str(const ObString &text,
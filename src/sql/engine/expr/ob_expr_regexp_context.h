@@ -109,6 +109,9 @@ public:
                             uint64_t pmatch_size,
                             common::ObExprStringBuf &string_buf,
                             common::ObIArray<common::ObString> &subexpr_array) const;
+  // get the regexp context cached in exec ctx for %expr, NULL returned if not reusable.
+  static int get_reusable_ctx(const ObExpr &expr, ObEvalCtx &ctx,
+                              ObExprRegexContext *&regexp_ctx);
   TO_STRING_KV(K_(inited));
 private:
   void reset_reg();
@@ -122,6 +125,11 @@ private:
           int64_t &chr_length,
           common::ObExprStringBuf &string_buf) const;
   int convert_reg_err_code_to_ob_err_code(int reg_err) const;
+  // Extract the longest literal that every match must contain into %must_literal_,
+  // empty if the pattern is too complex to decide.
+  void extract_must_literal();
+  // return true if %text can not match the pattern, decided by %must_literal_ only.
+  bool must_not_match(const common::ObString &text) const;
   int preprocess_pattern(common::ObExprStringBuf &string_buf,
                          const common::ObString &origin_pattern,
                          common::ObString &pattern);
@@ -132,6 +140,9 @@ private:
   ObInplaceAllocator pattern_allocator_;
   common::ObString pattern_;
   int cflags_;
+  // points into %pattern_, search in text with memmem before the regex engine.
+  common::ObString must_literal_;
+  bool must_literal_icase_;
 
   ObInplaceAllocator pattern_wc_allocator_;
 };
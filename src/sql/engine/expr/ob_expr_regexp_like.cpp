@@ -154,12 +154,14 @@ int ObExprRegexpLike::regexp_like(bool &match,
       } else {
         ObSEArray<size_t, 4> byte_num;
         ObSEArray<size_t, 4> byte_offsets;
-        if (OB_FAIL(ObExprUtil::get_mb_str_info(text,
+        // character offsets are only needed to locate line beginnings in multi-line mode.
+        if (!multi_flag) {
+        } else if (OB_FAIL(ObExprUtil::get_mb_str_info(text,
                                                 ObCharset::get_default_collation_oracle(CHARSET_UTF8MB4),
                                                 byte_num,
                                                 byte_offsets))) {
           LOG_WARN("failed to get mb str info", K(ret));
-        } else if (multi_flag) {
+        } else {
           if (from_begin && 1 != position) {
             begin_locations.pop_back();
           }
@@ -229,12 +231,51 @@ int ObExprRegexpLike::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
       const bool const_pattern = pattern->is_const_expr();
       rt_expr.extra_ = (!const_text && const_pattern) ? 1 : 0;
       rt_expr.eval_func_ = &eval_regexp_like;
+      rt_expr.eval_batch_func_ = &eval_regexp_like_batch;
       LOG_DEBUG("regexp like expr cg", K(const_text), K(const_pattern), K(rt_expr.extra_));
     }
   }
   return ret;
 }
 
+int ObExprRegexpLike::calc_regexp_like(const ObExpr &expr, ObEvalCtx &ctx,
+                                       const ObDatum &text, const ObDatum &pattern,
+                                       const ObDatum *flags, ObExprRegexContext *reusable_ctx,
+                                       ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  // use default flags if NULL == flags and flags->is_null()
+  bool is_flag_null = (NULL != flags && flags->is_null());
+  const bool null_result = (text.is_null() || pattern.is_null() ||
+                            (lib::is_mysql_mode() && is_flag_null));
+  ObString match_param = (NULL != flags && !flags->is_null())
+      ? flags->get_string()
+      : ObString();
+  const int64_t pos = 1;
+  const int64_t occurrence = 1;
+  ObEvalCtx::TempAllocGuard alloc_guard(ctx);
+  ObIAllocator &alloc = alloc_guard.get_allocator();
+  bool match = false;
+  ObExprRegexContext local_regex_ctx;
+  const bool reusable = (NULL != reusable_ctx);
+  ObExprRegexContext *regexp_ctx = reusable ? reusable_ctx : &local_regex_ctx;
+  if (lib::is_mysql_mode() && !pattern.is_null() &&
+      pattern.get_string().empty() && !is_flag_null) {//compatible mysql
+    ret = OB_ERR_REGEXP_ERROR;
+    LOG_WARN("empty regex expression", K(ret));
+  } else if (OB_FAIL(regexp_like(match, text.get_string(), pattern.get_string(), pos,
+                                 occurrence, expr.args_[0]->datum_meta_.cs_type_, match_param,
+                                 null_result, reusable, regexp_ctx, alloc,
+                                 ctx.exec_ctx_.get_allocator()))) {
+    LOG_WARN("do regexp like failed", K(ret));
+  } else if (null_result) {
+    expr_datum.set_null();
+  } else {
+    expr_datum.set_int32(match);
+  }
+  return ret;
+}
+
 int ObExprRegexpLike::eval_regexp_like(
     const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
 {
@@ -242,49 +283,46 @@ int ObExprRegexpLike::eval_regexp_like(
   ObDatum *text = NULL;
   ObDatum *pattern = NULL;
   ObDatum *flags = NULL;
+  ObExprRegexContext *regexp_ctx = NULL;
   if (OB_FAIL(expr.eval_param_value(ctx, text, pattern, flags))) {
     LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(ObExprRegexContext::get_reusable_ctx(expr, ctx, regexp_ctx))) {
+    LOG_WARN("get regexp context failed", K(ret));
+  } else if (OB_FAIL(calc_regexp_like(expr, ctx, *text, *pattern, flags, regexp_ctx,
+                                      expr_datum))) {
+    LOG_WARN("calc regexp like failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexpLike::eval_regexp_like_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                             const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObExprRegexContext *regexp_ctx = NULL;
+  if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
+    LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(ObExprRegexContext::get_reusable_ctx(expr, ctx, regexp_ctx))) {
+    LOG_WARN("get regexp context failed", K(ret));
   } else {
-    // use default flags if NULL == flags and flags->is_null()
-    bool is_flag_null = (NULL != flags && flags->is_null());
-    const bool null_result = (text->is_null() || pattern->is_null() ||
-                              (lib::is_mysql_mode() && is_flag_null));
-    ObString match_param = (NULL != flags && !flags->is_null())
-        ? flags->get_string()
-        : ObString();
-    const int64_t pos = 1;
-    const int64_t occurrence = 1;
-    ObEvalCtx::TempAllocGuard alloc_guard(ctx);
-    ObIAllocator &alloc = alloc_guard.get_allocator();
-    bool match = false;
-    ObExprRegexContext local_regex_ctx;
-    ObExprRegexContext *regexp_ctx = &local_regex_ctx;
-    const bool reusable = (0 != expr.extra_) && ObExpr::INVALID_EXP_CTX_ID != expr.expr_ctx_id_;
-    if (OB_SUCC(ret) && reusable) {
-      if (NULL == (regexp_ctx = static_cast<ObExprRegexContext *>(
-                  ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
-        if (OB_FAIL(ctx.exec_ctx_.create_expr_op_ctx(expr.expr_ctx_id_, regexp_ctx))) {
-          LOG_WARN("create expr regex context failed", K(ret), K(expr));
-        } else if (OB_ISNULL(regexp_ctx)) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("NULL context returned", K(ret));
-        }
-      }
+    ObDatum *results = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_array = expr.args_[0]->locate_expr_datumvector(ctx);
+    ObDatumVector pattern_array = expr.args_[1]->locate_expr_datumvector(ctx);
+    ObDatumVector flags_array;
+    if (3 == expr.arg_cnt_) {
+      flags_array = expr.args_[2]->locate_expr_datumvector(ctx);
     }
-    if (OB_FAIL(ret)) {
-    } else if (lib::is_mysql_mode() && !pattern->is_null() &&
-        pattern->get_string().empty() && !is_flag_null) {//compatible mysql
-      ret = OB_ERR_REGEXP_ERROR;
-      LOG_WARN("empty regex expression", K(ret));
-    } else if (OB_FAIL(regexp_like(match, text->get_string(), pattern->get_string(), pos,
-                                   occurrence, expr.args_[0]->datum_meta_.cs_type_, match_param,
-                                   null_result, reusable, regexp_ctx, alloc,
-                                   ctx.exec_ctx_.get_allocator()))) {
-      LOG_WARN("do regexp like failed", K(ret));
-    } else if (null_result) {
-      expr_datum.set_null();
-    } else {
-      expr_datum.set_int32(match);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      } else if (OB_FAIL(calc_regexp_like(expr, ctx, *text_array.at(i), *pattern_array.at(i),
+                                          3 == expr.arg_cnt_ ? flags_array.at(i) : NULL,
+                                          regexp_ctx, results[i]))) {
+        LOG_WARN("calc regexp like failed", K(ret), K(i));
+      } else {
+        eval_flags.set(i);
+      }
     }
   }
   return ret;
@@ -35,8 +35,14 @@ public:
   virtual bool need_rt_ctx() const override { return true; }
 
   static int eval_regexp_like(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int eval_regexp_like_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                    const ObBitVector &skip, const int64_t batch_size);
 
 private:
+  static int calc_regexp_like(const ObExpr &expr, ObEvalCtx &ctx,
+                              const ObDatum &text, const ObDatum &pattern,
+                              const ObDatum *flags, ObExprRegexContext *reusable_ctx,
+                              ObDatum &expr_datum);
   static int regexp_like(bool &match, const common::ObString &text,
            const common::ObString &pattern, int64_t position, int64_t occurrence,
            const common::ObCollationType calc_cs_type,
@@ -36,6 +36,8 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_replace(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int eval_replace_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                const ObBitVector &skip, const int64_t batch_size);
 
   // helper func
   static int replace(common::ObString &result,
@@ -44,6 +46,10 @@ public:
                      const common::ObString &to,
                      common::ObExprStringBuf &string_buf);
 private:
+  // replace with evaluated parameters, %to is NULL for two parameters replace().
+  static int calc_replace(const ObExpr &expr, ObEvalCtx &ctx,
+                          const common::ObDatum &text, const common::ObDatum &from,
+                          const common::ObDatum *to, common::ObDatum &expr_datum);
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObExprReplace);
 };
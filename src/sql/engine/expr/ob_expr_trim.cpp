@@ -400,25 +400,93 @@ int ObExprTrim::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &rt_expr) const
   int ret = OB_SUCCESS;
   CK(1 <= rt_expr.arg_cnt_ && rt_expr.arg_cnt_ <= 3);
   rt_expr.eval_func_ = eval_trim;
+  rt_expr.eval_batch_func_ = eval_trim_batch;
   return ret;
 }
 
 int ObExprTrim::eval_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
 {
   int ret = OB_SUCCESS;
-  bool has_null = false;
   if (OB_FAIL(expr.eval_param_value(ctx))) {
     LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (OB_FAIL(calc_trim(expr, ctx, expr_datum))) {
+    LOG_WARN("calc trim failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprTrim::eval_trim_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  const ObCharsetInfo *cs = ObCharset::get_charset(expr.datum_meta_.cs_type_);
+  if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
+    LOG_WARN("evaluate parameters failed", K(ret));
+  } else if (1 == expr.arg_cnt_ && OB_NOT_NULL(cs) && 1 == cs->mbminlen) {
+    // trim/ltrim/rtrim with the default ' ' pattern of single byte charset,
+    // scan the bytes directly instead of matching the pattern.
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObDatumVector text_datums = expr.args_[0]->locate_expr_datumvector(ctx);
+    const bool trim_left = T_FUN_SYS_RTRIM != expr.type_;
+    const bool trim_right = T_FUN_SYS_LTRIM != expr.type_;
+    const bool res_is_clob = lib::is_oracle_mode()
+                             && ob_is_text_tc(expr.args_[0]->datum_meta_.type_)
+                             && (CS_TYPE_BINARY != expr.args_[0]->datum_meta_.cs_type_);
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      ObDatum *text_datum = text_datums.at(i);
+      if (text_datum->is_null()) {
+        res[i].set_null();
+      } else {
+        const char *start = text_datum->ptr_;
+        const char *end = text_datum->ptr_ + text_datum->len_;
+        while (trim_left && start < end && ' ' == *start) {
+          ++start;
+        }
+        while (trim_right && start < end && ' ' == *(end - 1)) {
+          --end;
+        }
+        if (start == end && lib::is_oracle_mode() && !res_is_clob) {
+          res[i].set_null();
+        } else {
+          res[i].set_string(start, static_cast<int32_t>(end - start));
+        }
+      }
+      eval_flags.set(i);
+    }
   } else {
-    for (int64_t i = 0; i < expr.arg_cnt_; i++) {
-      if (expr.locate_param_datum(ctx, i).is_null()) {
-        has_null = true;
+    ObDatum *res = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
       }
+      batch_info_guard.set_batch_idx(i);
+      if (OB_FAIL(calc_trim(expr, ctx, res[i]))) {
+        LOG_WARN("calc trim failed", K(ret));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
+int ObExprTrim::calc_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum)
+{
+  int ret = OB_SUCCESS;
+  bool has_null = false;
+  for (int64_t i = 0; i < expr.arg_cnt_; i++) {
+    if (expr.locate_param_datum(ctx, i).is_null()) {
+      has_null = true;
     }
   }
 
-  if (OB_FAIL(ret)) {
-  } else if (has_null) {
+  if (has_null) {
     expr_datum.set_null();
   } else {
     int64_t trim_type = TYPE_LRTRIM;
@@ -637,6 +705,7 @@ int ObExprLtrim::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &rt_expr) cons
   CK(1 == rt_expr.arg_cnt_ || 2 == rt_expr.arg_cnt_);
   // trim type is detected by expr type in ObExprTrim::eval_trim
   rt_expr.eval_func_ = &ObExprTrim::eval_trim;
+  rt_expr.eval_batch_func_ = &ObExprTrim::eval_trim_batch;
   return ret;
 }
 
@@ -68,11 +68,15 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int eval_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int eval_trim_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                             const ObBitVector &skip, const int64_t batch_size);
 
   // fill ' ' to %buf with specified charset.
   static int fill_default_pattern(char *buf, const int64_t in_len,
                                   common::ObCollationType cs_type, int64_t &out_len);
 private:
+  // trim with evaluated parameters of current row
+  static int calc_trim(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
   // helper func
   static int lrtrim(const common::ObString src,
                     const common::ObString pattern,
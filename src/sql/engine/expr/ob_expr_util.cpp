@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX SQL_ENG
 #include "lib/utility/ob_tracepoint.h"
+#include "lib/utility/utility.h"
 #include "sql/engine/expr/ob_expr_util.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/ob_sql_utils.h"
@@ -643,3 +644,64 @@ int ObExprUtil::convert_utf8_charset(ObIAllocator& allocator,
   }
   return ret;
 }
+
+namespace oceanbase
+{
+namespace sql
+{
+typedef bool (*AsciiCasemapFunc)(const char *src, const int64_t len, char *dst, const bool lower);
+typedef bool (*IsAsciiStrFunc)(const char *str, const int64_t len);
+extern bool ascii_casemap_simd(const char *src, const int64_t len, char *dst, const bool lower);
+extern bool is_ascii_str_simd(const char *str, const int64_t len);
+
+bool ascii_casemap_normal(const char *src, const int64_t len, char *dst, const bool lower)
+{
+  bool is_ascii = true;
+  const char begin = lower ? 'A' : 'a';
+  const char end = lower ? 'Z' : 'z';
+  for (int64_t i = 0; is_ascii && i < len; ++i) {
+    const char c = src[i];
+    if (OB_UNLIKELY(static_cast<uint8_t>(c) >= 0x80)) {
+      is_ascii = false;
+    } else {
+      dst[i] = (c >= begin && c <= end) ? static_cast<char>(c ^ 0x20) : c;
+    }
+  }
+  return is_ascii;
+}
+
+bool is_ascii_str_normal(const char *str, const int64_t len)
+{
+  bool is_ascii = true;
+  for (int64_t i = 0; is_ascii && i < len; ++i) {
+    is_ascii = static_cast<uint8_t>(str[i]) < 0x80;
+  }
+  return is_ascii;
+}
+
+static AsciiCasemapFunc ascii_casemap_func = common::is_cpu_support_avx2()
+    ? ascii_casemap_simd
+    : ascii_casemap_normal;
+
+static IsAsciiStrFunc is_ascii_str_func = common::is_cpu_support_avx2()
+    ? is_ascii_str_simd
+    : is_ascii_str_normal;
+
+bool ObExprUtil::is_ascii_casemap_collation(const ObCollationType cs_type)
+{
+  const ObCharsetType charset = ObCharset::charset_type_by_coll(cs_type);
+  return CHARSET_UTF8MB4 == charset || CHARSET_GBK == charset || CHARSET_GB18030 == charset;
+}
+
+bool ObExprUtil::is_ascii_str(const char *str, const int64_t len)
+{
+  return is_ascii_str_func(str, len);
+}
+
+bool ObExprUtil::ascii_casemap(const char *src, const int64_t len, char *dst, const bool lower)
+{
+  return ascii_casemap_func(src, len, dst, lower);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -157,6 +157,16 @@ public:
                                   const common::ObString &from_string,
                                   common::ObString &dest_string);
 
+  // Whether ASCII characters of %cs_type are single bytes with the plain A-Z <=> a-z case
+  // mapping, so that pure ASCII strings can skip the charset case mapping functions.
+  static bool is_ascii_casemap_collation(const common::ObCollationType cs_type);
+  // Whether all bytes of %str are 7-bit ASCII.
+  static bool is_ascii_str(const char *str, const int64_t len);
+  // Map ASCII letters of %src to lower (or upper) case into %dst, %dst may be same as %src.
+  // Return false if any non-ASCII byte is met, %dst is partially written then and the caller
+  // should fall back to the charset case mapping.
+  static bool ascii_casemap(const char *src, const int64_t len, char *dst, const bool lower);
+
 private:
   static int get_int64_from_num(common::number::ObNumber &nmb,
                                 common::ObExprCtx &expr_ctx,
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace oceanbase
+{
+namespace sql
+{
+
+extern bool ascii_casemap_normal(const char *src, const int64_t len, char *dst, const bool lower);
+extern bool is_ascii_str_normal(const char *str, const int64_t len);
+
+// AVX2 version of ascii_casemap_normal(), 32 bytes per round.
+bool ascii_casemap_simd(const char *src, const int64_t len, char *dst, const bool lower)
+{
+#if defined(__x86_64__)
+  bool is_ascii = true;
+  int64_t pos = 0;
+  const __m256i begin = _mm256_set1_epi8(lower ? 'A' - 1 : 'a' - 1);
+  const __m256i end = _mm256_set1_epi8(lower ? 'Z' + 1 : 'z' + 1);
+  const __m256i case_bit = _mm256_set1_epi8(0x20);
+  for (; is_ascii && pos + 32 <= len; pos += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + pos));
+    if (0 != _mm256_movemask_epi8(v)) {
+      is_ascii = false;
+    } else {
+      // all bytes are positive here, signed compare is safe.
+      __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi8(v, begin),
+                                          _mm256_cmpgt_epi8(end, v));
+      v = _mm256_xor_si256(v, _mm256_and_si256(in_range, case_bit));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + pos), v);
+    }
+  }
+  return is_ascii && ascii_casemap_normal(src + pos, len - pos, dst + pos, lower);
+#else
+  return ascii_casemap_normal(src, len, dst, lower);
+#endif
+}
+
+// AVX2 version of is_ascii_str_normal(), 32 bytes per round.
+bool is_ascii_str_simd(const char *str, const int64_t len)
+{
+#if defined(__x86_64__)
+  bool is_ascii = true;
+  int64_t pos = 0;
+  for (; is_ascii && pos + 32 <= len; pos += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + pos));
+    is_ascii = (0 == _mm256_movemask_epi8(v));
+  }
+  return is_ascii && is_ascii_str_normal(str + pos, len - pos);
+#else
+  return is_ascii_str_normal(str, len);
+#endif
+}
+
+}  // namespace sql
+}  // namespace oceanbase
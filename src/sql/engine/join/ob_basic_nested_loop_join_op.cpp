@@ -15,6 +15,7 @@
 #include "sql/engine/join/ob_basic_nested_loop_join_op.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/join/ob_nested_loop_join_op.h"
+#include "sql/monitor/ob_phy_operator_stats.h"
 
 namespace oceanbase
 {
@@ -31,7 +32,7 @@ OB_SERIALIZE_MEMBER((ObBasicNestedLoopJoinSpec, ObJoinSpec),
 ObBasicNestedLoopJoinOp::ObBasicNestedLoopJoinOp(ObExecContext &exec_ctx,
                                                  const ObOpSpec &spec,
                                                  ObOpInput *input)
-  : ObJoinOp(exec_ctx, spec, input)
+  : ObJoinOp(exec_ctx, spec, input), is_rescanned_(false)
   {}
 
 int ObBasicNestedLoopJoinOp::inner_open()
@@ -46,6 +47,7 @@ int ObBasicNestedLoopJoinOp::inner_open()
 int ObBasicNestedLoopJoinOp::inner_rescan()
 {
   int ret = OB_SUCCESS;
+  is_rescanned_ = true;
   if (OB_FAIL(ObJoinOp::inner_rescan())) {
     LOG_WARN("failed to call parent rescan", K(ret));
   }
@@ -54,9 +56,45 @@ int ObBasicNestedLoopJoinOp::inner_rescan()
 
 int ObBasicNestedLoopJoinOp::inner_close()
 {
+  check_outer_misestimate();
   return OB_SUCCESS;
 }
 
+// An index nested loop join rescans the right side once per outer row, it is
+// chosen because the outer side is small for the parameters the plan was
+// generated with. When the outer side turns out to be orders of magnitude
+// larger than in the first execution of the plan, mark the cached plan expired,
+// so that the next execution regenerates it with the current parameters instead
+// of keep paying the rescans. Like the table row count check of update_plan_stat,
+// the baseline is the first execution rather than the optimizer estimation: a
+// regenerated plan would get the same estimation and be expired again.
+void ObBasicNestedLoopJoinOp::check_outer_misestimate()
+{
+  int ret = OB_SUCCESS;
+  ObPhysicalPlanCtx *plan_ctx = GET_PHY_PLAN_CTX(ctx_);
+  ObPhysicalPlan *plan = NULL;
+  bool is_increased = false;
+  if (get_spec().rescan_params_.empty() || is_rescanned_
+      || OB_ISNULL(left_) || OB_ISNULL(plan_ctx)
+      || OB_ISNULL(plan = const_cast<ObPhysicalPlan *>(plan_ctx->get_phy_plan()))) {
+    // do nothing
+  } else if (plan->is_expired() || !plan->stat_.enable_plan_expiration_) {
+    // do nothing
+  } else {
+    const int64_t real_rows = left_->get_monitor_info().output_row_count_;
+    if (OB_FAIL(plan->op_stats_.check_first_exec_rows(left_->get_spec().id_,
+                                                      real_rows,
+                                                      is_increased))) {
+      LOG_WARN("failed to check outer rows of first execution", K(ret), K(real_rows));
+    } else if (is_increased) {
+      plan->set_is_expired(true);
+      LOG_INFO("plan is expired due to outer side increase of nested loop join",
+               "op_id", get_spec().id_, "est_rows", left_->get_spec().rows_, K(real_rows),
+               "plan_id", plan->get_plan_id());
+    }
+  }
+}
+
 
 int ObBasicNestedLoopJoinOp::get_next_left_row()
 {
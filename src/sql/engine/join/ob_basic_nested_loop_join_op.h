@@ -71,6 +71,10 @@ public:
 
   int save_left_row();
   int recover_left_row();
+private:
+  void check_outer_misestimate();
+private:
+  bool is_rescanned_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObBasicNestedLoopJoinOp);
 };
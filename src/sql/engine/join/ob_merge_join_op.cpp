@@ -21,6 +21,8 @@ using namespace common;
 namespace sql
 {
 static const int64_t BATCH_MULTIPLE_TIMES = 10;
+// gallop only when enough rows remain in batch, otherwise compare row by row
+static const int64_t GALLOP_MIN_REMAIN_ROWS = 8;
 OB_SERIALIZE_MEMBER((ObMergeJoinSpec, ObJoinSpec), equal_cond_infos_,
                     merge_directions_, is_left_unique_,
                     left_child_fetcher_all_exprs_,
@@ -922,6 +924,7 @@ int ObMergeJoinOp::ChildBatchFecther::get_next_batch(const int64_t max_row_cnt)
       }
     }
   }
+  no_skip_rows_ = OB_SUCC(ret) && NULL != brs_.skip_ && brs_.skip_->is_all_false(brs_.size_);
   cur_idx_ = 0;
   LOG_DEBUG("end get next batch", K(this), K(brs_));
   return ret;
@@ -989,6 +992,55 @@ int ObMergeJoinOp::ChildBatchFecther::get_next_nonskip_row(bool &got_next_batch)
   return ret;
 }
 
+// Rows of current batch are sorted, skip rows smaller than current row of the other side by
+// galloping (exponential search, then binary search) instead of comparing them one by one.
+// %cur_idx_ must be a smaller row, it is moved to the last smaller row of the batch.
+template<bool is_left>
+int ObMergeJoinOp::ChildBatchFecther::gallop_smaller_rows()
+{
+  int ret = OB_SUCCESS;
+  if (no_skip_rows_ && cur_idx_ + GALLOP_MIN_REMAIN_ROWS < brs_.size_) {
+    const int64_t other_idx = is_left ? merge_join_op_.right_brs_fetcher_.cur_idx_
+                                      : merge_join_op_.left_brs_fetcher_.cur_idx_;
+    int64_t low = cur_idx_; // last row known to be smaller
+    int64_t high = brs_.size_; // first row known to be not smaller
+    int64_t step = 1;
+    int64_t cmp_res = 0;
+    bool high_found = false;
+    while (OB_SUCC(ret) && !high_found && low + step < high) {
+      const int64_t idx = low + step;
+      if (OB_FAIL(merge_join_op_.calc_equal_conds_with_batch_idx(is_left ? idx : other_idx,
+                                                                 is_left ? other_idx : idx,
+                                                                 cmp_res))) {
+        LOG_WARN("calc equal conds with batch index failed", K(ret));
+      } else if (is_left ? cmp_res < 0 : cmp_res > 0) {
+        low = idx;
+        step <<= 1;
+      } else {
+        high = idx;
+        high_found = true;
+      }
+    }
+    while (OB_SUCC(ret) && low + 1 < high) {
+      const int64_t idx = low + (high - low) / 2;
+      if (OB_FAIL(merge_join_op_.calc_equal_conds_with_batch_idx(is_left ? idx : other_idx,
+                                                                 is_left ? other_idx : idx,
+                                                                 cmp_res))) {
+        LOG_WARN("calc equal conds with batch index failed", K(ret));
+      } else if (is_left ? cmp_res < 0 : cmp_res > 0) {
+        low = idx;
+      } else {
+        high = idx;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_DEBUG("gallop smaller rows", K(is_left), K(cur_idx_), K(low), K(brs_.size_));
+      cur_idx_ = low;
+    }
+  }
+  return ret;
+}
+
 template<bool need_store_unmatch, bool is_left>
 int ObMergeJoinOp::ChildBatchFecther::get_next_small_group(int64_t &cmp_res)
 {
@@ -999,7 +1051,9 @@ int ObMergeJoinOp::ChildBatchFecther::get_next_small_group(int64_t &cmp_res)
   JoinRowList row_list(row_list_buffer_cnt_);
   ObEvalCtx::BatchInfoScopeGuard guard(merge_join_op_.eval_ctx_);
   while (OB_SUCC(ret) && !all_batch_finished && !greater_found && !enough_datums) {
-    if (need_store_unmatch && OB_LIKELY(cur_idx_ < brs_.size_)) {
+    if (!need_store_unmatch && OB_FAIL(gallop_smaller_rows<is_left>())) {
+      LOG_WARN("gallop smaller rows failed", K(ret));
+    } else if (need_store_unmatch && OB_LIKELY(cur_idx_ < brs_.size_)) {
       ObChunkDatumStore::StoredRow *stored_row = NULL;
       guard.set_batch_idx(cur_idx_);
       guard.set_batch_size(brs_.size_);
@@ -1144,11 +1198,18 @@ int ObMergeJoinOp::ChildBatchFecther::get_list_row(int64_t idx, ObStoredJoinRow
 
 // calc equal conds with specified left_fechter batch_idx and right_fechter batch_idx
 int ObMergeJoinOp::calc_equal_conds_with_batch_idx(int64_t &cmp_res)
+{
+  return calc_equal_conds_with_batch_idx(left_brs_fetcher_.cur_idx_,
+                                         right_brs_fetcher_.cur_idx_,
+                                         cmp_res);
+}
+
+int ObMergeJoinOp::calc_equal_conds_with_batch_idx(const int64_t l_table_batch_idx,
+                                                   const int64_t r_table_batch_idx,
+                                                   int64_t &cmp_res)
 {
   int ret = OB_SUCCESS;
   cmp_res = 0;
-  int64_t l_table_batch_idx = left_brs_fetcher_.cur_idx_;
-  int64_t r_table_batch_idx = right_brs_fetcher_.cur_idx_;
   for (int64_t i = 0;
        OB_SUCC(ret) && 0 == cmp_res && i < MY_SPEC.equal_cond_infos_.count();
        i++) {
@@ -221,7 +221,7 @@ private:
     ChildBatchFecther(ObIArray<RowsListPair> &match_groups,
         ObMergeJoinOp &merge_join_op,
         common::ObIAllocator &allocator) :
-        cur_idx_(0), brs_(), batch_size_(0), child_(NULL),
+        cur_idx_(0), brs_(), no_skip_rows_(false), batch_size_(0), child_(NULL),
         match_groups_(match_groups), merge_join_op_(merge_join_op),
         all_exprs_(NULL), datum_store_(), backup_datums_(),
         backup_rows_cnt_(0), brs_holder_(),
@@ -238,6 +238,8 @@ private:
                              const ObChunkDatumStore::StoredRow *stored_row,
                              const bool is_unique);
     int get_next_batch(const int64_t max_row_cnt);
+    template<bool is_left>
+    int gallop_smaller_rows();
     int backup_remain_rows();
     int get_next_nonskip_row(bool &got_next_batch);
     bool iter_end() { return brs_.end_ && 0 == brs_.size_; }
@@ -250,6 +252,7 @@ private:
       brs_.skip_ = NULL;
       brs_.size_ = 0;
       brs_.end_ = false;
+      no_skip_rows_ = false;
       datum_store_.reset();
       backup_datums_.reuse();
       backup_rows_cnt_ = 0;
@@ -263,6 +266,7 @@ private:
       brs_.skip_ = NULL;
       brs_.size_ = 0;
       brs_.end_ = false;
+      no_skip_rows_ = false;
       datum_store_.reset();
       backup_datums_.reset();
       backup_rows_cnt_ = 0;
@@ -271,6 +275,8 @@ private:
     }
     int64_t cur_idx_;
     ObBatchRows brs_;
+    // no row of %brs_ is skipped, computed once per batch for galloping
+    bool no_skip_rows_;
     int64_t batch_size_;
     ObOperator *child_;
     ObIArray<RowsListPair> &match_groups_;
@@ -438,6 +444,9 @@ private:
   }
   static int create_join_rows_list(JoinRowList *&row_list, ObIAllocator &allocator);
   int calc_equal_conds_with_batch_idx(int64_t &cmp_res);
+  int calc_equal_conds_with_batch_idx(const int64_t l_table_batch_idx,
+                                      const int64_t r_table_batch_idx,
+                                      int64_t &cmp_res);
   template<bool is_left_table_stored_row>
   int calc_equal_conds_with_stored_row(const ObChunkDatumStore::StoredRow *stored_row,
                                        int64_t batch_idx, int64_t &cmp_res);
@@ -877,6 +877,7 @@ int ObOperator::submit_op_monitor_node()
     // Some records that meets the conditions needs to be archived
     // Reference document: https://yuque.antfin.com/baixian.zr/brtfzn/ppx26a
     op_monitor_info_.close_time_ = oceanbase::common::ObClockGenerator::getClock();
+    IGNORE_RETURN submit_op_stat();
     ObPlanMonitorNodeList *list = MTL(ObPlanMonitorNodeList*);
     if (list && spec_.plan_) {
       if (spec_.plan_->get_phy_plan_hint().monitor_
@@ -903,6 +904,34 @@ int ObOperator::submit_op_monitor_node()
   return ret;
 }
 
+// Accumulate real output rows of this execution into plan level operator stats and
+// compare with the optimizer estimation. A plan with operators whose cardinality is
+// misestimated repeatedly is a candidate for re-optimization, see plan stat
+// card_misestimate_count_.
+int ObOperator::submit_op_stat()
+{
+  int ret = OB_SUCCESS;
+  bool is_misestimated = false;
+  ObPhysicalPlan *plan = const_cast<ObPhysicalPlan *>(spec_.plan_);
+  if (OB_ISNULL(plan)) {
+    // do nothing
+  } else if (OB_FAIL(plan->op_stats_.add_op_stat(spec_.id_,
+                                                 op_monitor_info_.output_row_count_,
+                                                 op_monitor_info_.rescan_times_,
+                                                 spec_.rows_,
+                                                 is_misestimated))) {
+    LOG_WARN("failed to add op stat", K(ret), K(spec_.id_));
+  } else if (is_misestimated) {
+    if (0 == ATOMIC_FAA(&plan->stat_.card_misestimate_count_, 1)) {
+      LOG_INFO("operator cardinality misestimated", "plan_id", plan->get_plan_id(),
+               "op_id", spec_.id_, "op_type", op_name(), "est_rows", spec_.rows_,
+               "output_rows", op_monitor_info_.output_row_count_,
+               "rescan_times", op_monitor_info_.rescan_times_);
+    }
+  }
+  return ret;
+}
+
 int ObOperator::get_next_row()
 {
   int ret = OB_SUCCESS;
@@ -560,6 +560,7 @@ private:
   int try_register_rt_monitor_node(int64_t rows);
   int try_deregister_rt_monitor_node();
   int submit_op_monitor_node();
+  int submit_op_stat();
   bool match_rt_monitor_condition(int64_t rows);
   int check_stack_once();
 protected:
@@ -455,6 +455,7 @@ void ObPhysicalPlan::update_plan_stat(const ObAuditRecordData &record,
     }
   } else { // long route stat begin
     execute_count = ATOMIC_AAF(&stat_.execute_times_, 1);
+    op_stats_.inc_execution_times();
     ATOMIC_AAF(&(stat_.total_process_time_), record.get_process_time());
     ATOMIC_AAF(&(stat_.disk_reads_), record.exec_record_.get_io_read_count());
     ATOMIC_AAF(&(stat_.direct_writes_), record.exec_record_.get_io_write_count());
@@ -166,6 +166,9 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
   pwj_rescan_task_infos_(),
   filter_count_(0),
   total_count_(0),
+  scan_time_(0),
+  fetch_time_(0),
+  granule_begin_ts_(0),
   bf_key_(),
   bloom_filter_ptr_(NULL),
   tablet2part_id_map_(),
@@ -173,6 +176,9 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
 {
   op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::FILTERED_GRANULE_COUNT;
   op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::TOTAL_GRANULE_COUNT;
+  op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::GRANULE_BUSY_TIME;
+  op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::GRANULE_FETCH_TIME;
+  op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::GRANULE_EXHAUSTED_TIMESTAMP;
 }
 
 void ObGranuleIteratorOp::destroy()
@@ -303,6 +309,7 @@ int ObGranuleIteratorOp::try_fetch_task(ObGranuleTaskInfo &info)
 //GI has its own rescan
 int ObGranuleIteratorOp::rescan()
 {
+  end_granule_scan();
   int ret = ObOperator::inner_rescan();
   CK(NULL != pump_);
   if (OB_FAIL(ret)) {
@@ -416,9 +423,26 @@ int ObGranuleIteratorOp::inner_open()
 
 int ObGranuleIteratorOp::inner_close()
 {
+  // workers closed before all granules are consumed (e.g. limit) report their time here
+  end_granule_scan();
+  report_granule_time();
   return OB_SUCCESS;
 }
 
+void ObGranuleIteratorOp::end_granule_scan()
+{
+  if (granule_begin_ts_ > 0) {
+    scan_time_ += ObTimeUtility::current_time() - granule_begin_ts_;
+    granule_begin_ts_ = 0;
+  }
+}
+
+void ObGranuleIteratorOp::report_granule_time()
+{
+  op_monitor_info_.otherstat_3_value_ = scan_time_;
+  op_monitor_info_.otherstat_4_value_ = fetch_time_;
+}
+
 int ObGranuleIteratorOp::inner_get_next_row()
 {
   const int64_t row_cnt = 1;
@@ -462,6 +486,7 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
     case GI_PREPARED :
     case GI_TABLE_SCAN : {
       if (!is_vectorized()) {
+        // timed per granule, see end_granule_scan()
         if (OB_FAIL(child_->get_next_row())) {
           LOG_DEBUG("failed to get new row", K(ret),
                     K(MY_SPEC.affinitize_), K(MY_SPEC.ref_table_id_), K(worker_id_));
@@ -470,6 +495,7 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
           } else {
             ret = OB_SUCCESS;
             state_ = GI_GET_NEXT_GRANULE_TASK;
+            end_granule_scan();
           }
         } else {
           LOG_DEBUG("get new row", K(ret),
@@ -477,6 +503,7 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
           got_next_row = true;
         }
       } else {
+        const int64_t scan_begin_ts = ObTimeUtility::current_time();
         const ObBatchRows *brs = NULL;
         if (OB_FAIL(child_->get_next_batch(max_row_cnt, brs))) {
           LOG_WARN("get next batch failed", K(ret));
@@ -492,6 +519,7 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
             state_ = GI_GET_NEXT_GRANULE_TASK;
           }
         }
+        scan_time_ += ObTimeUtility::current_time() - scan_begin_ts;
       }
       break;
     }
@@ -519,6 +547,7 @@ int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
 {
   int ret = OB_SUCCESS;
   bool partition_pruning = true;
+  const int64_t fetch_begin_ts = ObTimeUtility::current_time();
   while (OB_SUCC(ret) && partition_pruning) {
     if (OB_FAIL(do_get_next_granule_task(partition_pruning))) {
       if (ret != OB_ITER_END) {
@@ -526,6 +555,15 @@ int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
       }
     }
   }
+  const int64_t fetch_end_ts = ObTimeUtility::current_time();
+  fetch_time_ += fetch_end_ts - fetch_begin_ts;
+  if (OB_ITER_END == ret) {
+    // the gap between exhausted timestamps of workers in the same dfo is the
+    // tail time during which the early finished workers stay idle.
+    granule_begin_ts_ = 0;
+    report_granule_time();
+    op_monitor_info_.otherstat_5_value_ = fetch_end_ts;
+  }
   if (OB_SUCC(ret)) {
     if(!prepare && OB_FAIL(child_->rescan())) {
       /**
@@ -536,6 +574,13 @@ int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
     } else {
       state_ = GI_TABLE_SCAN;
     }
+    // rescan of the child starts the scan of the new granule. In row mode the granule
+    // is timed as a whole until its end, not per row, to keep clock reads off the row path.
+    if (is_vectorized()) {
+      scan_time_ += ObTimeUtility::current_time() - fetch_end_ts;
+    } else {
+      granule_begin_ts_ = fetch_end_ts;
+    }
   }
   return ret;
 }
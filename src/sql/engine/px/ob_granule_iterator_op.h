@@ -176,6 +176,9 @@ private:
   int fetch_full_pw_tasks(ObIArray<ObGranuleTaskInfo> &infos, const ObIArray<int64_t> &op_ids);
   int try_fetch_tasks(ObIArray<ObGranuleTaskInfo> &infos, const ObIArray<const ObTableScanSpec *> &tscs);
   int try_get_rows(const int64_t max_row_cnt);
+  // row mode only: add the time since the scan of current granule began to %scan_time_.
+  void end_granule_scan();
+  void report_granule_time();
   int do_get_next_granule_task(bool &partition_pruning);
   int prepare_table_scan();
   bool is_not_init() { return state_ == GI_UNINITIALIZED; }
@@ -223,6 +226,10 @@ private:
    //for partition pruning
   int64_t filter_count_; // filtered part count when part pruning activated
   int64_t total_count_; // total partition count or block count processed, rescan included
+  // for worker skew diagnosis, reported to plan monitor when all granules are consumed or closed
+  int64_t scan_time_; // time spent inside the child scan of granules, rescan included
+  int64_t fetch_time_; // time spent in fetching granules, pruning included
+  int64_t granule_begin_ts_; // row mode only: begin time of the granule being scanned, 0 if none
   ObPXBloomFilterHashWrapper bf_key_;
   ObPxBloomFilter *bloom_filter_ptr_;
   ObPxTablet2PartIdMap tablet2part_id_map_;
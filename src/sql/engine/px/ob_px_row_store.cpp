@@ -190,7 +190,7 @@ int ObReceiveRowReader::add_buffer(dtl::ObDtlLinkedBuffer &buf, bool &transferre
     if (dtl::PX_DATUM_ROW == buf.msg_type()) {
       auto block = reinterpret_cast<ObChunkDatumStore::Block *>(buf.buf());
       rows = block->rows_;
-      if (rows > 0 && OB_FAIL(block->swizzling(NULL))) {
+      if (rows > 0 && !buf.is_rows_swizzled() && OB_FAIL(block->swizzling(NULL))) {
         LOG_WARN("block swizzling failed", K(ret));
       }
     } else {
@@ -414,19 +414,22 @@ int ObRecursiveInnerDataOp::get_next_row()
   return ret;
 }
 
-// Note: keep batch size to one when generating output
-// The reason making output batch size to one is that the parent-child relation
-// or search path is maintained in method search tree and is processed for row
-// iteration. However, maintaining the parent-child relations or search paths
-// during batch iterating make it MUCH MUCH more complicated. And its benefits
-// outweight the overhead of maintaining the parent-child relation.
-// Thus, make recursive union all return output with batch size to 1 so far.
+// Note: the recursive iteration itself stays row by row
+// The parent-child relation or search path is maintained in method search tree
+// and the fake cte table is pumped with one parent row per iteration, because
+// maintaining the parent-child relations or search paths during batch iterating
+// make it MUCH MUCH more complicated.
+// However, rows already settled in result_output_ (e.g. a whole level of a
+// breadth first search) have no such dependency, so they are drained into the
+// output batch together, up to max_row_cnt rows per call.
 int ObRecursiveInnerDataOp::get_next_batch(const int64_t max_row_cnt,
                                            ObBatchRows &brs)
 {
   int ret = OB_SUCCESS;
-  UNUSED(max_row_cnt);
   LOG_DEBUG("Entrance of get_next_batch", K(result_output_.empty()), K(state_));
+  ObEvalCtx::BatchInfoScopeGuard guard(eval_ctx_);
+  guard.set_batch_size(max_row_cnt);
+  guard.set_batch_idx(0);
   if (!result_output_.empty()) {
     if (OB_FAIL(try_format_output_row())) {
       LOG_WARN("Format output row failed", K(ret));
@@ -462,8 +465,20 @@ int ObRecursiveInnerDataOp::get_next_batch(const int64_t max_row_cnt,
     if (brs.end_) {
       // do nothing already set in previouse block
     } else {
+      int64_t size = 1;
+      // Rows popped from result_output_ may be put into recycle_rows_ of the
+      // search method, which are freed and reused by the next finish_add_row().
+      // That only happens when the next batch is pumped, never inside this loop,
+      // so the datums projected to previous batch idx stay valid until the
+      // parent has consumed this batch.
+      for (; OB_SUCC(ret) && size < max_row_cnt && !result_output_.empty(); ++size) {
+        guard.set_batch_idx(size);
+        if (OB_FAIL(try_format_output_row())) {
+          LOG_WARN("Format output row failed", K(ret), K(size));
+        }
+      }
       brs.end_ = false;
-      brs.size_ = 1;
+      brs.size_ = size;
     }
   } else if (ret == OB_ITER_END) {
     brs.end_ = true;
@@ -149,17 +149,8 @@ int ObHashExceptOp::batch_process_right() {
       LOG_WARN("failed to find row", K(ret));
     } else if (OB_NOT_NULL(part_cols)) {
       part_cols->store_row_->set_is_match(true);
-    } else {
-      if (hp_infras_.has_left_dumped()) {
-        if (!hp_infras_.has_right_dumped()
-            && OB_FAIL(hp_infras_.create_dumped_partitions(InputSide::RIGHT))) {
-          LOG_WARN("failed to create dump partitions", K(ret));
-        } else if (OB_FAIL(hp_infras_.insert_row_on_partitions(*cur_exprs))) {
-          LOG_WARN("failed to insert row into partitions", K(ret));
-        }
-      } else {
-        //没有dumped， 也没有匹配上的right会被忽略
-      }
+    } else if (OB_FAIL(dump_unmatched_right_row(*cur_exprs))) {
+      LOG_WARN("failed to dump right row", K(ret));
     }
   }
   if (OB_ITER_END == ret) {
@@ -160,14 +160,8 @@ int ObHashIntersectOp::inner_get_next_row()
       }
     } else {
       // row is not exists in hash table
-      if (hp_infras_.has_left_dumped()) {
-        // dump right row if left is dumpe
-        if (!hp_infras_.has_right_dumped()
-            && OB_FAIL(hp_infras_.create_dumped_partitions(InputSide::RIGHT))) {
-          LOG_WARN("failed to create dump partitions", K(ret));
-        } else if (OB_FAIL(hp_infras_.insert_row_on_partitions(*cur_exprs))) {
-          LOG_WARN("failed to insert row into partitions", K(ret));
-        }
+      if (OB_FAIL(dump_unmatched_right_row(*cur_exprs))) {
+        LOG_WARN("failed to dump right row", K(ret));
       }
     }
   } //end of while
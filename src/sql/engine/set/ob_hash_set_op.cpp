@@ -51,12 +51,18 @@ int ObHashSetOp::inner_open()
     LOG_WARN("unexpected status: left or right is null", K(ret), K(left_), K(right_));
   } else if (OB_FAIL(ObOperator::inner_open())) {
     LOG_WARN("failed to inner open", K(ret));
+  } else {
+    op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::HASH_SET_DUMP_FILTERED_COUNT;
+    op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::HASH_SET_MAX_PART_LEVEL;
+    op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::HASH_SET_MAX_ROUND_MEM;
   }
   return ret;
 }
 
 void ObHashSetOp::reset()
 {
+  // filtered count of infrastructure is cleared by reset, accumulate it across rescan
+  op_monitor_info_.otherstat_1_value_ += hp_infras_.get_dump_filtered_row_cnt();
   first_get_left_ = true;
   has_got_part_ = false;
   left_brs_ = nullptr;
@@ -251,6 +257,8 @@ int ObHashSetOp::build_hash_table_from_left(bool from_child)
       LOG_WARN("failed to finish insert row", K(ret));
     } else if (!from_child && OB_FAIL(hp_infras_.close_cur_part(InputSide::LEFT))) {
       LOG_WARN("failed to close cur part", K(ret));
+    } else {
+      update_monitor_stat();
     }
     ret = OB_SUCCESS;
   }
@@ -314,6 +322,8 @@ int ObHashSetOp::build_hash_table_from_left_batch(bool from_child, const int64_t
       LOG_WARN("failed to finish insert", K(ret));
     } else if (!from_child && OB_FAIL(hp_infras_.close_cur_part(InputSide::LEFT))) {
       LOG_WARN("failed to close cur part", K(ret));
+    } else {
+      update_monitor_stat();
     }
   }
   return ret;
@@ -342,6 +352,11 @@ int ObHashSetOp::init_hash_partition_infras()
     const ObHashSetSpec &spec = static_cast<const ObHashSetSpec&>(get_spec());
     int64_t est_bucket_num = hp_infras_.est_bucket_count(est_rows, get_spec().width_);
     hp_infras_.set_io_event_observer(&io_event_observer_);
+    if (PHY_HASH_UNION != get_spec().type_) {
+      // right rows of intersect and except are never returned by themselves, so rows which can
+      // not match any dumped left row need not to be dumped.
+      hp_infras_.enable_left_dump_filter();
+    }
     if (OB_FAIL(hp_infras_.set_funcs(&spec.hash_funcs_, &spec.sort_collations_,
         &spec.sort_cmp_funs_, &eval_ctx_))) {
       LOG_WARN("failed to set funcs", K(ret));
@@ -355,6 +370,32 @@ int ObHashSetOp::init_hash_partition_infras()
 }
 
 
+int ObHashSetOp::dump_unmatched_right_row(const common::ObIArray<ObExpr*> &exprs)
+{
+  int ret = OB_SUCCESS;
+  bool may_exist = false;
+  if (OB_FAIL(hp_infras_.may_exist_in_left_dumped(exprs, may_exist))) {
+    LOG_WARN("failed to check left dumped rows", K(ret));
+  } else if (!may_exist) {
+    // no dumped left row can match, ignore it
+  } else if (!hp_infras_.has_right_dumped()
+             && OB_FAIL(hp_infras_.create_dumped_partitions(InputSide::RIGHT))) {
+    LOG_WARN("failed to create dump partitions", K(ret));
+  } else if (OB_FAIL(hp_infras_.insert_row_on_partitions(exprs))) {
+    LOG_WARN("failed to insert row into partitions", K(ret));
+  }
+  return ret;
+}
+
+// Called after the hash table of each round is built, which is the memory peak of the round.
+void ObHashSetOp::update_monitor_stat()
+{
+  op_monitor_info_.otherstat_2_value_ = max(op_monitor_info_.otherstat_2_value_,
+                                            hp_infras_.get_cur_level());
+  op_monitor_info_.otherstat_3_value_ = max(op_monitor_info_.otherstat_3_value_,
+                                            hp_infras_.get_cur_mem_used());
+}
+
 int ObHashSetOp::convert_row(
   const common::ObIArray<ObExpr*> &src_exprs, const common::ObIArray<ObExpr*> &dst_exprs)
 {
@@ -56,6 +56,9 @@ protected:
   int build_hash_table_from_left_batch(bool from_child, const int64_t batch_size);
   int init_hash_partition_infras();
   int init_hash_partition_infras_for_batch();
+  // used by intersect and except
+  int dump_unmatched_right_row(const common::ObIArray<ObExpr*> &exprs);
+  void update_monitor_stat();
   int convert_row(
     const common::ObIArray<ObExpr*> &src_exprs, const common::ObIArray<ObExpr*> &dst_exprs);
   int convert_batch(const common::ObIArray<ObExpr*> &src_exprs, 
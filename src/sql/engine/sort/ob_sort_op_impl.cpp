@@ -2527,9 +2527,25 @@ int ObInMemoryTopnSortImpl::add_batch(const common::ObIArray<ObExpr *> &exprs,
   // FIXME bin.lb: evaluate batch for each expr and set projected_ flag for performance?
   ObEvalCtx::BatchInfoScopeGuard batch_info_guard(*eval_ctx_);
   batch_info_guard.set_batch_size(batch_size);
+  // Once the heap is full its top is the boundary of the top-n, evaluate the first sort key
+  // for the whole batch and skip rows which are already behind the boundary on it.
+  const ObDatum *first_keys = NULL;
+  if (topn_cnt_ > 0 && !is_fetch_with_ties_ && !has_prefix_pos()
+      && sort_collations_->count() > 0) {
+    ObExpr *key = exprs.at(sort_collations_->at(0).field_idx_);
+    if (!key->is_batch_result()) {
+      // const key, can not filter anything
+    } else if (OB_FAIL(key->eval_batch(*eval_ctx_, skip, batch_size))) {
+      LOG_WARN("eval first sort key failed", K(ret));
+    } else {
+      first_keys = key->locate_batch_datums(*eval_ctx_);
+    }
+  }
   for (int64_t i = 0; i < batch_size && OB_SUCC(ret) && !need_sort; i++) {
     if (skip.at(i)) {
       continue;
+    } else if (NULL != first_keys && is_behind_topn_boundary(first_keys[i])) {
+      continue;
     }
     batch_info_guard.set_batch_idx(i);
     if (OB_FAIL(add_row(exprs, need_sort))) {
@@ -2539,6 +2555,20 @@ int ObInMemoryTopnSortImpl::add_batch(const common::ObIArray<ObExpr *> &exprs,
   return ret;
 }
 
+// The heap top is the last row of current top-n, row whose first sort key is ordered after
+// the top's can never replace it.
+bool ObInMemoryTopnSortImpl::is_behind_topn_boundary(const ObDatum &first_key) const
+{
+  bool behind = false;
+  if (topn_cnt_ > 0 && heap_.count() == topn_cnt_ && NULL != heap_.top()) {
+    const ObSortFieldCollation &collation = sort_collations_->at(0);
+    const int cmp = sort_cmp_funs_->at(0).cmp_func_(first_key,
+                                                    heap_.top()->cells()[collation.field_idx_]);
+    behind = collation.is_ascending_ ? cmp > 0 : cmp < 0;
+  }
+  return behind;
+}
+
 int ObInMemoryTopnSortImpl::adjust_topn_heap(const common::ObIArray<ObExpr*> &exprs)
 {
   int ret = OB_SUCCESS;
@@ -675,6 +675,7 @@ private:
     { get_extra_info().max_size_ = max_size; }
   };
 private:
+  bool is_behind_topn_boundary(const ObDatum &first_key) const;
   int adjust_topn_heap(const common::ObIArray<ObExpr*> &exprs);
   int adjust_topn_heap_with_ties(const common::ObIArray<ObExpr*> &exprs);
   int generate_new_row(const common::ObIArray<ObExpr*> &exprs,
@@ -19,6 +19,7 @@
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/engine/expr/ob_sql_expression.h"
 #include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_sql_mem_mgr_processor.h"
 #include "sql/engine/expr/ob_expr_func_ceil.h"
 #include "sql/engine/expr/ob_expr_add.h"
 #include "sql/engine/expr/ob_expr_minus.h"
@@ -317,6 +318,143 @@ DEF_TO_STRING(ObWindowFunctionOp::AggrCell)
   return pos;
 }
 
+int ObWindowFunctionOp::SegmentTree::init(const WinFuncInfo &wf_info, const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(wf_info.aggr_info_.expr_)
+      || OB_ISNULL(wf_info.aggr_info_.expr_->basic_funcs_)
+      || OB_ISNULL(wf_info.aggr_info_.expr_->basic_funcs_->null_first_cmp_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid aggr expr", K(ret), K(wf_info));
+  } else if (OB_FAIL(ObSqlWorkareaUtil::get_workarea_size(SORT_WORK_AREA, tenant_id,
+                                                          mem_limit_))) {
+    LOG_WARN("failed to get workarea size", K(ret), K(tenant_id));
+  } else {
+    alloc_.set_tenant_id(tenant_id);
+    alloc_.set_label("WfSegTree");
+    alloc_.set_ctx_id(ObCtxIds::WORK_AREA);
+    is_max_ = T_FUN_MAX == wf_info.func_type_;
+    // same compare function as ObAggregateProcessor::max_calc/min_calc
+    cmp_func_ = wf_info.aggr_info_.expr_->basic_funcs_->null_first_cmp_;
+    reuse();
+  }
+  return ret;
+}
+
+void ObWindowFunctionOp::SegmentTree::reuse()
+{
+  part_begin_ = 0;
+  leaf_cnt_ = 0;
+  leaves_ = NULL;
+  nodes_ = NULL;
+  built_ = false;
+  exceed_mem_limit_ = false;
+  alloc_.reset_remain_one_page();
+}
+
+void ObWindowFunctionOp::SegmentTree::destroy()
+{
+  reuse();
+  alloc_.reset();
+}
+
+int64_t ObWindowFunctionOp::SegmentTree::better(const int64_t l, const int64_t r) const
+{
+  int64_t res = l;
+  if (l < 0) {
+    res = r;
+  } else if (r < 0) {
+    res = l;
+  } else if (leaves_[l].is_null()) {
+    res = leaves_[r].is_null() ? std::min(l, r) : r;
+  } else if (leaves_[r].is_null()) {
+    res = l;
+  } else {
+    int cmp = cmp_func_(leaves_[l], leaves_[r]);
+    cmp = is_max_ ? -cmp : cmp;
+    res = cmp < 0 ? l : (cmp > 0 ? r : std::min(l, r));
+  }
+  return res;
+}
+
+int ObWindowFunctionOp::SegmentTree::build(ObWindowFunctionOp &op,
+                                           RowsStore &rows_store,
+                                           const WinFuncInfo &wf_info,
+                                           const int64_t part_begin,
+                                           const int64_t part_end)
+{
+  int ret = OB_SUCCESS;
+  reuse();
+  const int64_t cnt = part_end - part_begin + 1;
+  ObExpr *param_expr = wf_info.aggr_info_.param_exprs_.at(0);
+  if (OB_UNLIKELY(cnt <= 0) || OB_ISNULL(param_expr) || OB_ISNULL(cmp_func_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid argument", K(ret), K(part_begin), K(part_end), KP(param_expr));
+  } else if (static_cast<int64_t>(sizeof(ObDatum) + sizeof(int64_t) * 2) * cnt > mem_limit_) {
+    exceed_mem_limit_ = true;
+  } else if (OB_ISNULL(leaves_ = static_cast<ObDatum *>(alloc_.alloc(sizeof(ObDatum) * cnt)))
+             || OB_ISNULL(nodes_ = static_cast<int64_t *>(alloc_.alloc(sizeof(int64_t) * cnt * 2)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(cnt));
+  } else {
+    const ObRADatumStore::StoredRow *row = NULL;
+    ObDatum *val = NULL;
+    for (int64_t i = 0; OB_SUCC(ret) && !exceed_mem_limit_ && i < cnt; ++i) {
+      new (&leaves_[i]) ObDatum();
+      if (OB_FAIL(rows_store.get_row(part_begin + i, row))) {
+        LOG_WARN("get row failed", K(ret), K(part_begin), K(i));
+      } else if (FALSE_IT(op.clear_evaluated_flag())) {
+      } else if (OB_FAIL(row->to_expr(op.get_all_expr(), op.eval_ctx_))) {
+        LOG_WARN("Failed to to_expr", K(ret));
+      } else if (OB_FAIL(param_expr->eval(op.eval_ctx_, val))) {
+        LOG_WARN("eval aggr param failed", K(ret));
+      } else if (OB_FAIL(leaves_[i].deep_copy(*val, alloc_))) {
+        LOG_WARN("deep copy datum failed", K(ret));
+      } else {
+        nodes_[cnt + i] = i;
+        exceed_mem_limit_ = alloc_.used() > mem_limit_;
+      }
+    }
+    for (int64_t i = cnt - 1; OB_SUCC(ret) && !exceed_mem_limit_ && i > 0; --i) {
+      nodes_[i] = better(nodes_[2 * i], nodes_[2 * i + 1]);
+    }
+    if (OB_FAIL(ret)) {
+    } else if (exceed_mem_limit_) {
+      reuse();
+      exceed_mem_limit_ = true;
+    } else {
+      part_begin_ = part_begin;
+      leaf_cnt_ = cnt;
+      built_ = true;
+      LOG_DEBUG("segment tree built", K(*this));
+    }
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::SegmentTree::query(const Frame &frame, int64_t &best_idx) const
+{
+  int ret = OB_SUCCESS;
+  int64_t l = frame.head_ - part_begin_;
+  int64_t r = frame.tail_ - part_begin_ + 1;
+  if (OB_UNLIKELY(!built_ || l < 0 || r > leaf_cnt_ || l >= r)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid frame", K(ret), K(frame), K(*this));
+  } else {
+    int64_t res = -1;
+    for (l += leaf_cnt_, r += leaf_cnt_; l < r; l >>= 1, r >>= 1) {
+      if (l & 1) {
+        res = better(res, nodes_[l++]);
+      }
+      if (r & 1) {
+        res = better(res, nodes_[--r]);
+      }
+    }
+    best_idx = part_begin_ + res;
+  }
+  return ret;
+}
+
 template <typename OP>
 int ObWindowFunctionOp::foreach_stores(OP op)
 {
@@ -1099,8 +1237,12 @@ int ObWindowFunctionOp::init()
             } else {
               AggrCell *aggr_func = new (tmp_ptr) AggrCell(wf_info, *this, *aggr_infos);
               aggr_func->aggr_processor_.set_in_window_func();
+              aggr_func->use_seg_tree_ = AggrCell::is_seg_tree_supported(wf_info);
               if (OB_FAIL(aggr_func->aggr_processor_.init())) {
                 LOG_WARN("failed to initialize init_group_rows", K(ret));
+              } else if (aggr_func->use_seg_tree_
+                         && OB_FAIL(aggr_func->seg_tree_.init(wf_info, tenant_id))) {
+                LOG_WARN("failed to init segment tree", K(ret));
               } else {
                 aggr_func->aggr_processor_.set_dir_id(dir_id_);
                 aggr_func->aggr_processor_.set_io_event_observer(&io_event_observer_);
@@ -1409,7 +1551,32 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
       if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
-        if (!Frame::same_frame(last_valid_frame, new_frame)) {
+        if (Frame::same_frame(last_valid_frame, new_frame)) {
+          LOG_DEBUG("use last value");
+          // reuse last result, invoke final directly...
+        } else if (aggr_func->use_seg_tree_
+                   && !aggr_func->seg_tree_.is_built()
+                   && !aggr_func->seg_tree_.is_exceed_mem_limit()
+                   && OB_FAIL(aggr_func->seg_tree_.build(*this, *input_rows_.cur_,
+                                                         wf_cell.wf_info_,
+                                                         part_frame.head_, part_frame.tail_))) {
+          LOG_WARN("build segment tree failed", K(ret), K(part_frame));
+        } else if (aggr_func->use_seg_tree_ && aggr_func->seg_tree_.is_built()) {
+          // extremum of frame is found by segment tree, aggregate that single row only.
+          // the tree is not built if the partition is too large, restart aggregation instead.
+          int64_t best_idx = -1;
+          if (OB_FAIL(aggr_func->seg_tree_.query(new_frame, best_idx))) {
+            LOG_WARN("query segment tree failed", K(ret), K(new_frame));
+          } else if (FALSE_IT(aggr_func->reset_for_restart())) {
+          } else if (OB_FAIL(input_rows_.cur_->get_row(best_idx, cur_row))) {
+            LOG_WARN("get cur row failed", K(ret), K(best_idx));
+          } else if (FALSE_IT(clear_evaluated_flag())) {
+          } else if (OB_FAIL(cur_row->to_expr(get_all_expr(), eval_ctx_))) {
+            LOG_WARN("Failed to to_expr", K(ret));
+          } else if (OB_FAIL(aggr_func->trans(*cur_row))) {
+            LOG_WARN("trans failed", K(ret));
+          }
+        } else {
           if (!Frame::need_restart_aggr(aggr_func->can_inv(), last_valid_frame, new_frame,
                                         aggr_func->aggr_processor_.get_removal_info(),
                                         wf_cell.wf_info_.remove_type_)) {
@@ -1485,9 +1652,6 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
               }
             }
           }
-        } else {
-          LOG_DEBUG("use last value");
-          // reuse last result, invoke final directly...
         }
         if (OB_SUCC(ret)) {
           if (OB_FAIL(aggr_func->final(val))) {
@@ -2571,6 +2735,10 @@ int ObWindowFunctionOp::compute_wf_values(const WinFuncCell *end, int64_t &check
         OB_SUCC(ret) && wf != end;
         wf = wf->get_next()) {
     wf->reset_for_restart();
+    if (wf->is_aggr() && static_cast<AggrCell *>(wf)->use_seg_tree_) {
+      // segment tree is built lazily for the new partition
+      static_cast<AggrCell *>(wf)->seg_tree_.reuse();
+    }
     ObDatum result_datum;
     RowsReader row_reader(*input_rows_.cur_);
     if (wf == wf_list_.get_last()) {
@@ -406,6 +406,53 @@ public:
     ObRADatumStore::Reader reader_;
   };
 
+  // Segment tree over the aggregate parameter of the current partition, used by MIN/MAX with a
+  // sliding frame head. Leaf values are copied once per partition, every frame is answered in
+  // O(log n) by returning the row index which holds the extremum of the frame.
+  // The tree memory is limited by the sort work area size, it is not built for partitions
+  // exceeding the limit.
+  class SegmentTree
+  {
+  public:
+    SegmentTree()
+      : alloc_(), is_max_(false), cmp_func_(NULL), mem_limit_(0), part_begin_(0), leaf_cnt_(0),
+        leaves_(NULL), nodes_(NULL), built_(false), exceed_mem_limit_(false) {}
+    ~SegmentTree() { destroy(); }
+    int init(const WinFuncInfo &wf_info, const uint64_t tenant_id);
+    void destroy();
+    void reuse();
+    inline bool is_built() const { return built_; }
+    inline bool is_exceed_mem_limit() const { return exceed_mem_limit_; }
+    // build tree for rows [part_begin, part_end] of %rows_store, not built and
+    // exceed_mem_limit_ is set if the memory limit is reached.
+    int build(ObWindowFunctionOp &op,
+              RowsStore &rows_store,
+              const WinFuncInfo &wf_info,
+              const int64_t part_begin,
+              const int64_t part_end);
+    // %best_idx is row index of the extremum in [frame.head_, frame.tail_], NULL values are
+    // chosen only if all values in frame are NULL.
+    int query(const Frame &frame, int64_t &best_idx) const;
+    TO_STRING_KV(K_(is_max), K_(mem_limit), K_(part_begin), K_(leaf_cnt), K_(built),
+                 K_(exceed_mem_limit));
+  private:
+    // return the better leaf of %l and %r, -1 means no leaf.
+    inline int64_t better(const int64_t l, const int64_t r) const;
+  private:
+    common::ObArenaAllocator alloc_;
+    bool is_max_;
+    ObExprCmpFuncType cmp_func_;
+    int64_t mem_limit_;
+    int64_t part_begin_;
+    int64_t leaf_cnt_;
+    common::ObDatum *leaves_;
+    // nodes_[leaf_cnt_ + i] is leaf i, nodes_[i] (0 < i < leaf_cnt_) is the better one of
+    // nodes_[2 * i] and nodes_[2 * i + 1]
+    int64_t *nodes_;
+    bool built_;
+    bool exceed_mem_limit_;
+  };
+
   class WinFuncCell : public common::ObDLinkBase<WinFuncCell>
   {
   public:
@@ -450,7 +497,9 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc"),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        use_seg_tree_(false),
+        seg_tree_()
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -476,6 +525,14 @@ public:
 
     virtual int final(common::ObDatum &val);
     virtual bool is_aggr() const { return true; }
+    // MIN/MAX with a frame head not fixed to the partition start need restart aggregation
+    // whenever the extremum slides out of frame, evaluate them by segment tree instead.
+    static bool is_seg_tree_supported(const WinFuncInfo &wf_info)
+    {
+      return (T_FUN_MIN == wf_info.func_type_ || T_FUN_MAX == wf_info.func_type_)
+          && 1 == wf_info.aggr_info_.param_exprs_.count()
+          && !(wf_info.upper_.is_preceding_ && wf_info.upper_.is_unbounded_);
+    }
     DECLARE_VIRTUAL_TO_STRING;
   protected:
     // whether aggregate function support single line translate and inverse translate.
@@ -494,6 +551,8 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    bool use_seg_tree_;
+    SegmentTree seg_tree_;
   };
 
   class NonAggrCell : public WinFuncCell
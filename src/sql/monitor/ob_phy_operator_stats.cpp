@@ -84,6 +84,63 @@ int ObPhyOperatorStats::add_op_stat(ObPhyOperatorMonitorInfo &info)
   return ret;
 }
 
+int ObPhyOperatorStats::add_op_stat(const int64_t op_id,
+                                    const int64_t output_rows,
+                                    const int64_t rescan_times,
+                                    const int64_t est_rows,
+                                    bool &is_misestimated)
+{
+  int ret = OB_SUCCESS;
+  const int64_t COPY_SIZE = op_count_ * StatId::MAX_STAT;
+  int64_t copy_start_index = (get_cpu_id() % COPY_COUNT) * COPY_SIZE;
+  int64_t stat_start_index = copy_start_index + op_id * StatId::MAX_STAT;
+  is_misestimated = false;
+  if (OB_ISNULL(op_stats_array_)) {
+    // operator stats is not inited, e.g. plan of px worker, do nothing
+  } else if (stat_start_index < 0 || stat_start_index + StatId::MAX_STAT > array_size_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invaild array index", K(stat_start_index), K(array_size_));
+  } else {
+    is_misestimated = is_card_misestimated(est_rows, output_rows / (rescan_times + 1));
+    ATOMIC_AAF(&(op_stats_array_[stat_start_index + StatId::OUTPUT_ROWS]), output_rows);
+    ATOMIC_AAF(&(op_stats_array_[stat_start_index + StatId::RESCAN_TIMES]), rescan_times);
+  }
+  return ret;
+}
+
+bool ObPhyOperatorStats::is_card_misestimated(const int64_t est_rows, const int64_t real_rows)
+{
+  const int64_t max_rows = std::max(est_rows, real_rows);
+  const int64_t min_rows = std::max(std::min(est_rows, real_rows), static_cast<int64_t>(1));
+  return max_rows >= CARD_MISESTIMATE_MIN_ROWS && max_rows / min_rows >= CARD_MISESTIMATE_RATIO;
+}
+
+int ObPhyOperatorStats::check_first_exec_rows(const int64_t op_id,
+                                              const int64_t rows,
+                                              bool &is_increased)
+{
+  int ret = OB_SUCCESS;
+  const int64_t stat_index = op_id * StatId::MAX_STAT + StatId::FIRST_EXEC_ROWS;
+  is_increased = false;
+  if (OB_ISNULL(op_stats_array_)) {
+    // operator stats is not inited, e.g. plan of px worker, do nothing
+  } else if (op_id < 0 || op_id >= op_count_ || rows < 0) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invaild operator id", K(op_id), K(op_count_), K(rows));
+  } else {
+    // 0 means no execution recorded yet, so rows + 1 is stored
+    int64_t first_exec_rows = ATOMIC_LOAD(&(op_stats_array_[stat_index]));
+    if (0 == first_exec_rows
+        && ATOMIC_BCAS(&(op_stats_array_[stat_index]), 0, rows + 1)) {
+      // first execution of the plan, keep as baseline
+    } else {
+      first_exec_rows = ATOMIC_LOAD(&(op_stats_array_[stat_index])) - 1;
+      is_increased = rows > first_exec_rows && is_card_misestimated(first_exec_rows, rows);
+    }
+  }
+  return ret;
+}
+
 int ObPhyOperatorStats::get_op_stat_accumulation(ObPhysicalPlan *plan,
                                                  int64_t op_id,
                                                  ObOperatorStat &stat)
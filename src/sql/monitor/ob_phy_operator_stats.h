@@ -32,6 +32,7 @@ enum StatId{
   INPUT_ROWS = 0,
   RESCAN_TIMES,
   OUTPUT_ROWS,
+  FIRST_EXEC_ROWS, // only kept in the first copy, rows + 1 of the first execution
   MAX_STAT
 };
 }
@@ -47,8 +48,23 @@ public:
   ~ObPhyOperatorStats() {}
   int init(common::ObIAllocator *alloc, int64_t op_count);
   int add_op_stat(ObPhyOperatorMonitorInfo &info);
+  // accumulate one execution of operator op_id, est_rows is the output rows estimated
+  // by optimizer for one scan (not including rescans) of the operator
+  int add_op_stat(const int64_t op_id,
+                  const int64_t output_rows,
+                  const int64_t rescan_times,
+                  const int64_t est_rows,
+                  bool &is_misestimated);
+  static bool is_card_misestimated(const int64_t est_rows, const int64_t real_rows);
+  // the first call for op_id records rows as the baseline of the plan, later calls set
+  // is_increased if rows is misestimated against the baseline and larger than it
+  int check_first_exec_rows(const int64_t op_id, const int64_t rows, bool &is_increased);
   int get_op_stat_accumulation(ObPhysicalPlan *plan, int64_t op_id, ObOperatorStat &stat);
   static const int64_t COPY_COUNT = 10;
+  // an execution is misestimated if the real rows per scan is CARD_MISESTIMATE_RATIO times
+  // larger or smaller than estimated, and at least CARD_MISESTIMATE_MIN_ROWS rows on either side
+  static const int64_t CARD_MISESTIMATE_RATIO = 100;
+  static const int64_t CARD_MISESTIMATE_MIN_ROWS = 1000;
   int64_t count() { return op_count_; }
   void inc_execution_times() { ATOMIC_INC(&execution_times_); }
   int64_t get_execution_times() const { return execution_times_; }
@@ -476,9 +476,12 @@ int ObOptSelectivity::calculate_selectivity(const OptTableMetas &table_metas,
   selectivity = 1.0;
   ObSEArray<ObRawExpr *, 4> join_conditions;
   ObSEArray<RangeExprs, 3> range_conditions;
+  ObSEArray<OptEqualFilterSel, 4> equal_filters;
   ObRawExpr *qual = NULL;
   double tmp_selectivity = 1.0;
   bool need_skip = false;
+  bool is_equal_filter = false;
+  const bool use_column_group_sel = ctx.get_opt_ctx().enable_column_group_sel();
   for (int64_t i = 0; OB_SUCC(ret) && i < predicates.count(); ++i) {
     qual = predicates.at(i);
     LOG_TRACE("calculate qual selectivity", "expr", PNAME(qual));
@@ -493,12 +496,23 @@ int ObOptSelectivity::calculate_selectivity(const OptTableMetas &table_metas,
     } else if (OB_FAIL(calculate_qual_selectivity(table_metas, ctx, *qual,
                                                   tmp_selectivity, all_predicate_sel))) {
       LOG_WARN("failed to calculate one qual selectivity", K(*qual), K(ret));
-    } else {
-      tmp_selectivity = revise_between_0_1(tmp_selectivity);
+    } else if (FALSE_IT(tmp_selectivity = revise_between_0_1(tmp_selectivity))) {
+    } else if (use_column_group_sel &&
+               OB_FAIL(check_column_equal_filter(*qual, tmp_selectivity,
+                                                 equal_filters, is_equal_filter))) {
+      LOG_WARN("failed to check column equal filter", K(ret));
+    } else if (!is_equal_filter) {
       selectivity *= tmp_selectivity;
     }
     LOG_TRACE("after calculate one qual selectivity", K(need_skip), K(tmp_selectivity), K(selectivity));
   }
+  if (OB_SUCC(ret) && !equal_filters.empty()) {
+    if (OB_FAIL(get_column_group_equal_sel(table_metas, equal_filters, tmp_selectivity))) {
+      LOG_WARN("failed to get column group equal selectivity", K(ret));
+    } else {
+      selectivity *= revise_between_0_1(tmp_selectivity);
+    }
+  }
   for (int64_t i = 0 ; OB_SUCC(ret) && i < range_conditions.count() ; ++i) {
     tmp_selectivity = 1.0;
     ObColumnRefRawExpr *col_expr = range_conditions.at(i).column_expr_;
@@ -619,6 +633,90 @@ int ObOptSelectivity::is_simple_join_condition(ObRawExpr &qual,
   return ret;
 }
 
+int ObOptSelectivity::check_column_equal_filter(const ObRawExpr &qual,
+                                                const double selectivity,
+                                                ObIArray<OptEqualFilterSel> &equal_filters,
+                                                bool &is_valid)
+{
+  int ret = OB_SUCCESS;
+  is_valid = false;
+  if (T_OP_EQ == qual.get_expr_type()) {
+    const ObRawExpr *expr0 = qual.get_param_expr(0);
+    const ObRawExpr *expr1 = qual.get_param_expr(1);
+    if (OB_ISNULL(expr0) || OB_ISNULL(expr1)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get null exprs", K(ret), K(expr0), K(expr1));
+    } else if (OB_FAIL(ObOptimizerUtil::get_expr_without_lossless_cast(expr0, expr0)) ||
+               OB_FAIL(ObOptimizerUtil::get_expr_without_lossless_cast(expr1, expr1))) {
+      LOG_WARN("failed to get expr without lossless cast", K(ret));
+    } else {
+      if (!expr0->is_column_ref_expr()) {
+        std::swap(expr0, expr1);
+      }
+      if (expr0->is_column_ref_expr() && !expr1->has_flag(CNT_COLUMN)) {
+        const ObColumnRefRawExpr *col = static_cast<const ObColumnRefRawExpr *>(expr0);
+        if (OB_FAIL(equal_filters.push_back(OptEqualFilterSel(col->get_table_id(),
+                                                              col->get_column_id(),
+                                                              selectivity)))) {
+          LOG_WARN("failed to push back equal filter", K(ret));
+        } else {
+          is_valid = true;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObOptSelectivity::get_column_group_equal_sel(const OptTableMetas &table_metas,
+                                                 ObIArray<OptEqualFilterSel> &equal_filters,
+                                                 double &selectivity)
+{
+  int ret = OB_SUCCESS;
+  selectivity = 1.0;
+  ObSEArray<uint64_t, 4> col_ids;
+  if (!equal_filters.empty()) {
+    std::sort(&equal_filters.at(0), &equal_filters.at(0) + equal_filters.count());
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < equal_filters.count(); ) {
+    const uint64_t table_id = equal_filters.at(i).table_id_;
+    double group_sel = 1.0;
+    double exponent = 1.0;
+    bool is_pkey = false;
+    bool is_union_pkey = false;
+    col_ids.reuse();
+    for (; OB_SUCC(ret) && i < equal_filters.count() &&
+           equal_filters.at(i).table_id_ == table_id; ++i) {
+      const OptEqualFilterSel &filter = equal_filters.at(i);
+      if (ObOptimizerUtil::find_item(col_ids, filter.column_id_)) {
+        // `c1 = 1 and c1 = 2`, conflict filters on one column
+        group_sel *= filter.selectivity_;
+      } else if (OB_FAIL(col_ids.push_back(filter.column_id_))) {
+        LOG_WARN("failed to push back column id", K(ret));
+      } else {
+        group_sel *= std::pow(filter.selectivity_, exponent);
+        exponent /= 2;
+      }
+    }
+    if (OB_FAIL(ret) || col_ids.count() < 2) {
+      // do nothing
+    } else if (OB_FAIL(is_columns_contain_pkey(table_metas, col_ids, table_id,
+                                               is_pkey, is_union_pkey))) {
+      LOG_WARN("failed to check is columns contain pkey", K(ret));
+    } else if (is_pkey) {
+      const OptTableMeta *table_meta = table_metas.get_table_meta_by_table_id(table_id);
+      if (OB_NOT_NULL(table_meta) && table_meta->get_rows() > 1.0) {
+        group_sel = std::min(group_sel, 1.0 / table_meta->get_rows());
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_TRACE("get column group equal selectivity", K(table_id), K(col_ids), K(group_sel));
+      selectivity *= group_sel;
+    }
+  }
+  return ret;
+}
+
 int ObOptSelectivity::calculate_qual_selectivity(const OptTableMetas &table_metas,
                                                  const OptSelectivityCtx &ctx,
                                                  const ObRawExpr &qual,
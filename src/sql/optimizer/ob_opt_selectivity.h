@@ -323,6 +323,30 @@ struct OptSelInfo
   bool has_range_exprs_;
 };
 
+// selectivity of filter `column = const`, see get_column_group_equal_sel
+struct OptEqualFilterSel
+{
+  OptEqualFilterSel() :
+    table_id_(common::OB_INVALID_ID),
+    column_id_(common::OB_INVALID_ID),
+    selectivity_(1.0) {}
+  OptEqualFilterSel(const uint64_t table_id, const uint64_t column_id, const double selectivity) :
+    table_id_(table_id),
+    column_id_(column_id),
+    selectivity_(selectivity) {}
+
+  bool operator<(const OptEqualFilterSel &other) const
+  {
+    return table_id_ < other.table_id_ ||
+           (table_id_ == other.table_id_ && selectivity_ < other.selectivity_);
+  }
+  TO_STRING_KV(K_(table_id), K_(column_id), K_(selectivity));
+
+  uint64_t table_id_;
+  uint64_t column_id_;
+  double selectivity_;
+};
+
 struct ObEstColRangeInfo
 {
   ObEstColRangeInfo(double min,
@@ -349,6 +373,7 @@ class ObOptSelectivity
 {
 public:
   // @brief 计算一组条件的选择率，条件之间是and关系，基于独立性假设
+  // 打开_enable_column_group_selectivity时, 同一个表上多列的等值条件例外, 见get_column_group_equal_sel
   static int calculate_selectivity(const OptTableMetas &table_metas,
                                    const OptSelectivityCtx &ctx,
                                    const common::ObIArray<ObRawExpr*> &quals,
@@ -411,6 +436,25 @@ private:
                                       bool &is_valid,
                                       ObIArray<ObRawExpr *> &join_conditions);
 
+  static int check_column_equal_filter(const ObRawExpr &qual,
+                                       const double selectivity,
+                                       ObIArray<OptEqualFilterSel> &equal_filters,
+                                       bool &is_valid);
+
+  /**
+   * Selectivity of `c1 = ? and c2 = ? ...` on the same table. Columns of one table are
+   * often correlated (city and zip code), multiplying the selectivity of each column
+   * underestimates the result by orders of magnitude. Without multi column statistics we
+   * use exponential backoff: sort the selectivity of the columns ascending, then
+   * selectivity = s1 * s2^(1/2) * s3^(1/4) * ...
+   * If the columns contain the primary key, at most one row is matched.
+   * Only used if _enable_column_group_selectivity or the opt_param hint
+   * enable_column_group_selectivity is on.
+   */
+  static int get_column_group_equal_sel(const OptTableMetas &table_metas,
+                                        ObIArray<OptEqualFilterSel> &equal_filters,
+                                        double &selectivity);
+
   /**
    * calculate const or calculable expr selectivity.
    * e.g. `1`, `1 = 1`, `1 + 1`, `1 = 0`
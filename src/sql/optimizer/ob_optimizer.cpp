@@ -675,6 +675,8 @@ int ObOptimizer::init_env_info(ObDMLStmt &stmt)
   uint64_t tenant_id = session->get_effective_tenant_id();
   omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
   bool rowsets_enabled = tenant_config.is_valid() && tenant_config->_rowsets_enabled;
+  bool column_group_sel_enabled = tenant_config.is_valid()
+                                  && tenant_config->_enable_column_group_selectivity;
   if (OB_FAIL(stmt.get_query_ctx()->get_global_hint().opt_params_.get_bool_opt_param(
                                       ObOptParamHint::ROWSETS_ENABLED, rowsets_enabled))) {
     LOG_WARN("fail to check rowsets enabled", K(ret));
@@ -683,6 +685,13 @@ int ObOptimizer::init_env_info(ObDMLStmt &stmt)
   } else {
     ctx_.set_cost_model_type(ObOptEstCost::NORMAL_MODEL);
   }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(stmt.get_query_ctx()->get_global_hint().opt_params_.get_bool_opt_param(
+                ObOptParamHint::ENABLE_COLUMN_GROUP_SELECTIVITY, column_group_sel_enabled))) {
+    LOG_WARN("fail to check column group selectivity enabled", K(ret));
+  } else {
+    ctx_.set_enable_column_group_sel(column_group_sel_enabled);
+  }
   LOG_TRACE("succeed to init optimization env", K(ctx_.use_pdml()), K(ctx_.get_parallel()));
   return ret;
 }
@@ -146,7 +146,8 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
     aggregation_optimization_settings_(0),
     query_ctx_(query_ctx),
     nested_sql_flags_(0),
-    has_for_update_(false)
+    has_for_update_(false),
+    enable_column_group_sel_(false)
   { }
   inline common::ObOptStatManager *get_opt_stat_manager() { return opt_stat_manager_; }
   inline void set_opt_stat_manager(common::ObOptStatManager *sm) { opt_stat_manager_ = sm; }
@@ -462,6 +463,8 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
   bool contain_user_nested_sql() const { return nested_sql_flags_ > 0 && !is_online_ddl_; }
   void set_for_update() { has_for_update_ = true; }
   bool has_for_update() { return has_for_update_;};
+  void set_enable_column_group_sel(bool v) { enable_column_group_sel_ = v; }
+  bool enable_column_group_sel() const { return enable_column_group_sel_; }
 
 private:
   ObSQLSessionInfo *session_info_;
@@ -529,6 +532,9 @@ private:
     };
   };
   bool has_for_update_;
+  // estimate equal filters on one table as a column group, see
+  // ObOptSelectivity::get_column_group_equal_sel
+  bool enable_column_group_sel_;
 };
 }
 }
@@ -1360,7 +1360,7 @@ int ObFastParserBase::process_comment_content()
       is_match = true;
       break;;
     } else {
-      ch = raw_sql_.scan();
+      ch = raw_sql_.scan_until('*', '*');
     }
   }
   if (!is_match) {
@@ -1834,8 +1834,8 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
+        ch = raw_sql_.scan_until('\\', quote);
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2305,8 +2305,8 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
+        ch = raw_sql_.scan_until('\\', '\'');
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -731,12 +731,28 @@ int ObParser::reconstruct_insert_sql(const common::ObString &stmt,
     } else {
       // restore the allocator
       allocator_ = bak_allocator;
+      const int64_t shared_length = parse_result.ins_multi_value_res_->values_col_;
+      // all the rewritten queries share one buffer, the statement may carry
+      // thousands of values, avoid one allocation per row
+      int64_t total_length = 0;
+      char *new_sql_buf = NULL;
+      int64_t pos = 0;
+      for (ParenthesesOffset *current_obj = parse_result.ins_multi_value_res_->ref_parentheses_;
+             NULL != current_obj;
+             current_obj = current_obj->next_) {
+        total_length += shared_length + (current_obj->right_parentheses_ - current_obj->left_parentheses_ + 1) + 1;
+      }
+      if (OB_FAIL(ins_queries.reserve(parse_result.ins_multi_value_res_->values_count_))) {
+        LOG_WARN("fail to reserve ins queries", K(ret),
+                 K(parse_result.ins_multi_value_res_->values_count_));
+      } else if (OB_ISNULL(new_sql_buf = static_cast<char*>(allocator_->alloc(total_length)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to alloc memory", K(ret), K(total_length));
+      }
       for (ParenthesesOffset *current_obj = parse_result.ins_multi_value_res_->ref_parentheses_;
              OB_SUCC(ret) && NULL != current_obj;
              current_obj = current_obj->next_) {
-        char *new_sql_buf = NULL;
-        int64_t pos = 0;
-        const int64_t shared_length = parse_result.ins_multi_value_res_->values_col_;
+        const int64_t begin_pos = pos;
         // The reason for +1 here is
         // insert into t1 values(1,1),(2,2);
         // left_parentheses_ is the offset of the first left parenthesis，
@@ -745,16 +761,13 @@ int ObParser::reconstruct_insert_sql(const common::ObString &stmt,
         const int64_t values_length = current_obj->right_parentheses_ - current_obj->left_parentheses_ + 1;
         // The reason for here + 1 is to add a delimiter;
         const int64_t final_length = shared_length + values_length + 1; // 这个+1的原因是
-        if (OB_ISNULL(new_sql_buf = static_cast<char*>(allocator_->alloc(final_length)))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("fail to alloc memory", K(ret), K(final_length));
-        } else if (OB_FAIL(databuff_memcpy(new_sql_buf, final_length, pos, shared_length, stmt.ptr()))) {
-          LOG_WARN("failed to deep copy new sql", K(ret), K(final_length), K(shared_length), K(pos), K(stmt));
-        } else if (OB_FAIL(databuff_memcpy(new_sql_buf, final_length, pos, values_length, (stmt.ptr() + (current_obj->left_parentheses_ - 1))))) {
-          LOG_WARN("failed to deep copy member list buf", K(ret), K(final_length), K(pos), K(stmt), K(values_length));
+        if (OB_FAIL(databuff_memcpy(new_sql_buf, total_length, pos, shared_length, stmt.ptr()))) {
+          LOG_WARN("failed to deep copy new sql", K(ret), K(total_length), K(shared_length), K(pos), K(stmt));
+        } else if (OB_FAIL(databuff_memcpy(new_sql_buf, total_length, pos, values_length, (stmt.ptr() + (current_obj->left_parentheses_ - 1))))) {
+          LOG_WARN("failed to deep copy member list buf", K(ret), K(total_length), K(pos), K(stmt), K(values_length));
         } else {
-          new_sql_buf[final_length - 1] = ';';
-          ObString part(final_length, new_sql_buf);
+          new_sql_buf[pos++] = ';';
+          ObString part(final_length, new_sql_buf + begin_pos);
           if (OB_FAIL(ins_queries.push_back(part))) {
             LOG_WARN("fail to push back query str", K(ret), K(part));
           }
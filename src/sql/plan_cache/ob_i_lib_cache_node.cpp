@@ -153,7 +153,10 @@ int ObILibCacheNode::lock(bool is_rdlock)
 int ObILibCacheNode::update_node_stat(ObILibCacheCtx &ctx)
 {
   int ret = OB_SUCCESS;
-  ATOMIC_STORE(&(node_stat_.last_active_timestamp_), ObTimeUtility::current_time());
+  const int64_t now = ObTimeUtility::fast_current_time();
+  if (now - ATOMIC_LOAD(&(node_stat_.last_active_timestamp_)) > ACTIVE_TS_REFRESH_INTERVAL) {
+    ATOMIC_STORE(&(node_stat_.last_active_timestamp_), now);
+  }
   ATOMIC_INC(&(node_stat_.execute_count_));
   return ret;
 }
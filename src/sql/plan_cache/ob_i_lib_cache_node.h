@@ -97,6 +97,9 @@ class ObILibCacheNode
 {
 friend class ObLCNodeFactory;
 public:
+  // last_active_timestamp_ only feeds the eviction weight, refresh it at this
+  // granularity so that hot nodes are not written by every lookup
+  static const int64_t ACTIVE_TS_REFRESH_INTERVAL = 10 * 1000; // 10ms
   ObILibCacheNode(ObPlanCache *lib_cache, lib::MemoryContext &mem_context)
     : mem_context_(mem_context),
       allocator_(mem_context->get_safe_arena_allocator()),
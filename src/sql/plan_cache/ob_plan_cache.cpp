@@ -503,7 +503,10 @@ int ObPlanCache::construct_multi_stmt_fast_parser_result(common::ObIAllocator &a
 {
   int ret = OB_SUCCESS;
   const common::ObIArray<ObString> *queries = NULL;
-  bool enable_explain_batched_multi_statement = ObSQLUtils::is_enable_explain_batched_multi_statement();
+  // queries rewritten from insert multi values all begin with the insert keyword
+  bool enable_explain_batched_multi_statement =
+      !pc_ctx.sql_ctx_.multi_stmt_item_.is_ins_multi_val_opt()
+      && ObSQLUtils::is_enable_explain_batched_multi_statement();
   if (OB_ISNULL(queries = pc_ctx.sql_ctx_.multi_stmt_item_.get_queries())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("get unexpected null", K(queries), K(ret));
@@ -400,6 +400,7 @@ int ObConfigInfoInPC::load_influence_plan_config()
     rowsets_enabled_ = tenant_config->_rowsets_enabled;
     enable_px_batch_rescan_ = tenant_config->_enable_px_batch_rescan;
     bloom_filter_enabled_ = tenant_config->_bloom_filter_enabled;
+    enable_column_group_sel_ = tenant_config->_enable_column_group_selectivity;
   }
 
   return ret;
@@ -430,6 +431,9 @@ int ObConfigInfoInPC::serialize_configs(char *buf, int buf_len, int64_t &pos)
   } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
                               "%d,", enable_newsort_))) {
     SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_newsort_));
+  } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                              "%d,", enable_column_group_sel_))) {
+    SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_column_group_sel_));
   } else {
     // do nothing
   }
@@ -514,6 +514,9 @@ struct ObPlanStat
   ObTableRowCount *table_row_count_first_exec_;
   int64_t access_table_num_;         //plan访问的表的个数，目前只统计whole range扫描的表
   bool is_expired_; // 这个计划是否已经由于数据的表行数变化和执行时间变化而失效
+  // number of operator executions whose real output rows are far from the estimated rows,
+  // see ObPhyOperatorStats::is_card_misestimated
+  int64_t card_misestimate_count_;
 
   // check whether plan has stable performance
   bool enable_plan_expiration_;
@@ -602,6 +605,7 @@ struct ObPlanStat
       table_row_count_first_exec_(NULL),
       access_table_num_(0),
       is_expired_(false),
+      card_misestimate_count_(0),
       enable_plan_expiration_(false),
       first_exec_row_count_(-1),
       sessid_(0),
@@ -672,6 +676,7 @@ struct ObPlanStat
       table_row_count_first_exec_(NULL),
       access_table_num_(0),
       is_expired_(false),
+      card_misestimate_count_(0),
       enable_plan_expiration_(rhs.enable_plan_expiration_),
       first_exec_row_count_(rhs.first_exec_row_count_),
       sessid_(rhs.sessid_),
@@ -929,6 +934,7 @@ public:
     enable_px_batch_rescan_(true),
     bloom_filter_enabled_(true),
     enable_newsort_(true),
+    enable_column_group_sel_(false),
     cluster_config_version_(-1),
     tenant_config_version_(-1),
     tenant_id_(0)
@@ -965,6 +971,7 @@ public:
   bool enable_px_ordered_coord_;
   bool bloom_filter_enabled_;
   bool enable_newsort_;
+  bool enable_column_group_sel_;
 
 private:
   // current cluster config version_
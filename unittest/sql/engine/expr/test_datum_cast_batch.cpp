@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_datum_cast.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_bit_vector.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace oceanbase
+{
+namespace sql
+{
+extern int cast_eval_arg_batch(const ObExpr &, ObEvalCtx &, const ObBitVector &, const int64_t);
+}
+}
+
+// Check that batch cast kernels give the same results and errors as the per-row cast
+// (cast_eval_arg_batch).
+class TestDatumCastBatch : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 256;
+  static const int64_t RES_BUF_LEN = 64;
+
+  TestDatumCastBatch()
+    : alloc_(ObModIds::TEST), exec_ctx_(alloc_), eval_ctx_(NULL), skip_(NULL),
+      arg_(NULL), type_(NULL), cast_(NULL)
+  {}
+
+  virtual void SetUp() override
+  {
+    const int64_t frame_size = 3 * (sizeof(ObDatum) + RES_BUF_LEN) * BATCH_SIZE + 4096;
+    exec_ctx_.frames_ = static_cast<char **>(alloc_.alloc(sizeof(char *)));
+    ASSERT_TRUE(NULL != exec_ctx_.frames_);
+    exec_ctx_.frames_[0] = static_cast<char *>(alloc_.alloc(frame_size));
+    ASSERT_TRUE(NULL != exec_ctx_.frames_[0]);
+    MEMSET(exec_ctx_.frames_[0], 0, frame_size);
+    exec_ctx_.frame_cnt_ = 1;
+    eval_ctx_ = new (alloc_.alloc(sizeof(ObEvalCtx))) ObEvalCtx(exec_ctx_);
+    eval_ctx_->max_batch_size_ = BATCH_SIZE;
+
+    void *skip_buf = alloc_.alloc(ObBitVector::memory_size(BATCH_SIZE));
+    ASSERT_TRUE(NULL != skip_buf);
+    skip_ = to_bit_vector(skip_buf);
+    skip_->init(BATCH_SIZE);
+
+    int64_t pos = 0;
+    arg_ = new_expr(pos);
+    type_ = new_expr(pos);
+    cast_ = new_expr(pos);
+    cast_->args_ = static_cast<ObExpr **>(alloc_.alloc(2 * sizeof(ObExpr *)));
+    cast_->args_[0] = arg_;
+    cast_->args_[1] = type_;
+    cast_->arg_cnt_ = 2;
+  }
+
+  virtual void TearDown() override
+  {
+    eval_ctx_->~ObEvalCtx();
+    alloc_.reset();
+  }
+
+  ObExpr *new_expr(int64_t &pos)
+  {
+    ObExpr *expr = new (alloc_.alloc(sizeof(ObExpr))) ObExpr();
+    expr->frame_idx_ = 0;
+    expr->batch_result_ = true;
+    expr->batch_idx_mask_ = UINT64_MAX;
+    expr->datum_off_ = pos;
+    pos += sizeof(ObDatum) * BATCH_SIZE;
+    expr->eval_info_off_ = pos;
+    pos += sizeof(ObEvalInfo);
+    expr->eval_flags_off_ = pos;
+    pos += ObBitVector::memory_size(BATCH_SIZE);
+    expr->pvt_skip_off_ = pos;
+    pos += ObBitVector::memory_size(BATCH_SIZE);
+    expr->res_buf_off_ = pos;
+    expr->res_buf_len_ = RES_BUF_LEN;
+    pos += RES_BUF_LEN * BATCH_SIZE;
+    expr->reset_datums_ptr(exec_ctx_.frames_[0], BATCH_SIZE);
+    return expr;
+  }
+
+  void set_types(const ObObjType in_type, const ObObjType out_type,
+                 const ObCastMode cast_mode = CM_WARN_ON_FAIL)
+  {
+    arg_->datum_meta_ = ObDatumMeta(in_type, CS_TYPE_UTF8MB4_GENERAL_CI, 0);
+    arg_->obj_meta_.set_type(in_type);
+    cast_->datum_meta_ = ObDatumMeta(out_type, CS_TYPE_UTF8MB4_GENERAL_CI, 0);
+    cast_->obj_meta_.set_type(out_type);
+    cast_->extra_ = cast_mode;
+    ASSERT_EQ(OB_SUCCESS, ObDatumCast::choose_cast_function(in_type, CS_TYPE_UTF8MB4_GENERAL_CI,
+                                                            out_type, CS_TYPE_UTF8MB4_GENERAL_CI,
+                                                            cast_->extra_, alloc_, *cast_));
+    ASSERT_NE(cast_eval_arg_batch, cast_->eval_batch_func_);
+    // argument is projected, no need to evaluate
+    ObEvalInfo &info = arg_->get_eval_info(*eval_ctx_);
+    info.evaluated_ = true;
+    info.projected_ = true;
+    info.notnull_ = true;
+    info.point_to_frame_ = true;
+    info.cnt_ = BATCH_SIZE;
+  }
+
+  // fill argument datums with %vals repeatedly, NULL string stands for null datum.
+  void fill_string_args(const char *vals[], const int64_t cnt)
+  {
+    ObDatum *args = arg_->locate_batch_datums(*eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      const char *str = vals[i % cnt];
+      if (NULL == str) {
+        args[i].set_null();
+        arg_->get_eval_info(*eval_ctx_).notnull_ = false;
+      } else {
+        args[i].set_string(str, static_cast<int32_t>(strlen(str)));
+      }
+    }
+  }
+
+  void fill_number_args(const char *vals[], const int64_t cnt)
+  {
+    ObDatum *args = arg_->locate_batch_datums(*eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      const char *str = vals[i % cnt];
+      if (NULL == str) {
+        args[i].set_null();
+        arg_->get_eval_info(*eval_ctx_).notnull_ = false;
+      } else {
+        number::ObNumber nmb;
+        ASSERT_EQ(OB_SUCCESS, nmb.from(str, alloc_));
+        args[i].set_number(nmb);
+      }
+    }
+  }
+
+  int eval(const ObExpr::EvalBatchFunc func, ObDatum *res)
+  {
+    int ret = OB_SUCCESS;
+    const ObExpr::EvalBatchFunc kernel = cast_->eval_batch_func_;
+    const bool arg_notnull = arg_->get_eval_info(*eval_ctx_).notnull_;
+    cast_->eval_batch_func_ = func;
+    cast_->get_eval_info(*eval_ctx_).clear_evaluated_flag();
+    cast_->get_eval_info(*eval_ctx_).notnull_ = false;
+    cast_->get_evaluated_flags(*eval_ctx_).reset(BATCH_SIZE);
+    ObDatum *datums = cast_->locate_batch_datums(*eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      datums[i].set_null();
+    }
+    if (OB_SUCC(cast_->eval_batch(*eval_ctx_, *skip_, BATCH_SIZE))) {
+      for (int64_t i = 0; i < BATCH_SIZE; i++) {
+        res[i].deep_copy(datums[i], alloc_);
+      }
+    }
+    cast_->eval_batch_func_ = kernel;
+    arg_->get_eval_info(*eval_ctx_).notnull_ = arg_notnull;
+    return ret;
+  }
+
+  // evaluate by per-row cast and batch kernel, return the error code of both.
+  int compare(const char *name)
+  {
+    ObDatum row_res[BATCH_SIZE];
+    ObDatum batch_res[BATCH_SIZE];
+    const int row_ret = eval(cast_eval_arg_batch, row_res);
+    const int batch_ret = eval(cast_->eval_batch_func_, batch_res);
+    EXPECT_EQ(row_ret, batch_ret) << name;
+    if (OB_SUCCESS == row_ret && OB_SUCCESS == batch_ret) {
+      for (int64_t i = 0; i < BATCH_SIZE; i++) {
+        EXPECT_TRUE(ObDatum::binary_equal(row_res[i], batch_res[i])) << name << " row " << i;
+      }
+    }
+    return row_ret;
+  }
+
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx *eval_ctx_;
+  ObBitVector *skip_;
+  ObExpr *arg_;
+  ObExpr *type_;
+  ObExpr *cast_;
+};
+
+TEST_F(TestDatumCastBatch, int_number_with_null)
+{
+  set_types(ObIntType, ObNumberType);
+  ObDatum *args = arg_->locate_batch_datums(*eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    if (0 == i % 5) {
+      args[i].set_null();
+    } else if (1 == i % 5) {
+      args[i].set_int(0 == i % 2 ? INT64_MAX : INT64_MIN);
+    } else {
+      args[i].set_int(i * 1000003 - 100000);
+    }
+  }
+  arg_->get_eval_info(*eval_ctx_).notnull_ = false;
+  ASSERT_EQ(OB_SUCCESS, compare("int -> number"));
+}
+
+TEST_F(TestDatumCastBatch, number_int)
+{
+  static const char *vals[] = { "0", "12345.678", "-0.5", "-42", NULL,
+                                "9223372036854775807", "-9223372036854775808",
+                                "9223372036854775808", "-9223372036854775809", "1e30" };
+  set_types(ObNumberType, ObIntType);
+  fill_number_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("number -> int, warn on fail"));
+
+  // overflow of int64 is an error without CM_WARN_ON_FAIL
+  set_types(ObNumberType, ObIntType, CM_NONE);
+  fill_number_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_NE(OB_SUCCESS, compare("number -> int, strict"));
+}
+
+TEST_F(TestDatumCastBatch, number_tinyint_range_check)
+{
+  static const char *vals[] = { "127", "-128", "128", "-129", "300", "1.5", NULL };
+  set_types(ObNumberType, ObTinyIntType);
+  fill_number_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("number -> tinyint, warn on fail"));
+
+  set_types(ObNumberType, ObTinyIntType, CM_NONE);
+  fill_number_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_NE(OB_SUCCESS, compare("number -> tinyint, strict"));
+
+  static const char *in_range_vals[] = { "127", "-128", "0", "-1", NULL };
+  fill_number_args(in_range_vals, ARRAYSIZEOF(in_range_vals));
+  ASSERT_EQ(OB_SUCCESS, compare("number -> tinyint, strict in range"));
+}
+
+TEST_F(TestDatumCastBatch, number_double_exact_int_boundary)
+{
+  // integral numbers within +/-2^53 are cast directly, others are formatted and parsed.
+  static const char *vals[] = { "9007199254740991", "9007199254740992", "9007199254740993",
+                                "-9007199254740992", "-9007199254740993",
+                                "9223372036854775807", "-9223372036854775808",
+                                "18446744073709551616", "0.1", "-1.5", "0", NULL };
+  set_types(ObNumberType, ObDoubleType);
+  fill_number_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("number -> double"));
+}
+
+TEST_F(TestDatumCastBatch, string_int_invalid)
+{
+  static const char *vals[] = { "1", "-42", " 77", "1234567890", NULL, "abc", "12abc", "",
+                                "99999999999999999999", "1.6" };
+  set_types(ObVarcharType, ObIntType);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> int, warn on fail"));
+
+  set_types(ObVarcharType, ObIntType, CM_WARN_ON_FAIL | CM_NULL_ON_WARN);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> int, null on warn"));
+
+  set_types(ObVarcharType, ObIntType, CM_NONE);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_NE(OB_SUCCESS, compare("varchar -> int, strict"));
+
+  static const char *valid_vals[] = { "1", "-42", "1234567890", NULL };
+  fill_string_args(valid_vals, ARRAYSIZEOF(valid_vals));
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> int, strict valid"));
+}
+
+TEST_F(TestDatumCastBatch, string_number_invalid)
+{
+  static const char *vals[] = { "1.5", "-42", "3.1415926535", "1e10", NULL, "abc", "1.2.3",
+                                "", " 7 " };
+  set_types(ObVarcharType, ObNumberType);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> number, warn on fail"));
+
+  set_types(ObVarcharType, ObNumberType, CM_WARN_ON_FAIL | CM_NULL_ON_WARN);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> number, null on warn"));
+
+  set_types(ObVarcharType, ObNumberType, CM_NONE);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  ASSERT_NE(OB_SUCCESS, compare("varchar -> number, strict"));
+}
+
+TEST_F(TestDatumCastBatch, skip_rows)
+{
+  static const char *vals[] = { "1", "abc", NULL, "-7" };
+  set_types(ObVarcharType, ObIntType, CM_NONE);
+  fill_string_args(vals, ARRAYSIZEOF(vals));
+  // rows which can not be cast are skipped
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    if (1 == i % ARRAYSIZEOF(vals)) {
+      skip_->set(i);
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, compare("varchar -> int, skip"));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_datum_cast_batch.log", true);
+  return RUN_ALL_TESTS();
+}
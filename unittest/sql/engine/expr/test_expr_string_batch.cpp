@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr.h"
+#include "sql/engine/expr/ob_expr_lower.h"
+#include "sql/engine/expr/ob_expr_length.h"
+#include "sql/engine/expr/ob_expr_concat.h"
+#include "sql/engine/expr/ob_expr_trim.h"
+#include "sql/engine/expr/ob_expr_replace.h"
+#include "sql/engine/expr/ob_expr_instr.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_bit_vector.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+// Check that batch evaluation of string functions gives the same results as the per-row
+// evaluation (expr_default_eval_batch_func).
+class TestExprStringBatch : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 64;
+  static const int64_t RES_BUF_LEN = 32;
+  static const int64_t MAX_ARG_CNT = 3;
+
+  TestExprStringBatch()
+    : alloc_(ObModIds::TEST), exec_ctx_(alloc_), eval_ctx_(NULL), skip_(NULL), expr_(NULL)
+  {
+    MEMSET(args_, 0, sizeof(args_));
+  }
+
+  virtual void SetUp() override
+  {
+    const int64_t frame_size = (MAX_ARG_CNT + 1)
+        * ((sizeof(ObDatum) + RES_BUF_LEN + sizeof(ObDynReserveBuf)) * BATCH_SIZE + 1024);
+    exec_ctx_.frames_ = static_cast<char **>(alloc_.alloc(sizeof(char *)));
+    ASSERT_TRUE(NULL != exec_ctx_.frames_);
+    exec_ctx_.frames_[0] = static_cast<char *>(alloc_.alloc(frame_size));
+    ASSERT_TRUE(NULL != exec_ctx_.frames_[0]);
+    MEMSET(exec_ctx_.frames_[0], 0, frame_size);
+    exec_ctx_.frame_cnt_ = 1;
+    eval_ctx_ = new (alloc_.alloc(sizeof(ObEvalCtx))) ObEvalCtx(exec_ctx_);
+    eval_ctx_->max_batch_size_ = BATCH_SIZE;
+
+    void *skip_buf = alloc_.alloc(ObBitVector::memory_size(BATCH_SIZE));
+    ASSERT_TRUE(NULL != skip_buf);
+    skip_ = to_bit_vector(skip_buf);
+    skip_->init(BATCH_SIZE);
+
+    int64_t pos = 0;
+    for (int64_t i = 0; i < MAX_ARG_CNT; i++) {
+      args_[i] = new_expr(pos);
+    }
+    expr_ = new_expr(pos);
+    expr_->args_ = args_;
+  }
+
+  virtual void TearDown() override
+  {
+    eval_ctx_->~ObEvalCtx();
+    alloc_.reset();
+  }
+
+  ObExpr *new_expr(int64_t &pos)
+  {
+    ObExpr *expr = new (alloc_.alloc(sizeof(ObExpr))) ObExpr();
+    expr->frame_idx_ = 0;
+    expr->batch_result_ = true;
+    expr->batch_idx_mask_ = UINT64_MAX;
+    expr->datum_off_ = pos;
+    pos += sizeof(ObDatum) * BATCH_SIZE;
+    expr->eval_info_off_ = pos;
+    pos += sizeof(ObEvalInfo);
+    expr->eval_flags_off_ = pos;
+    pos += ObBitVector::memory_size(BATCH_SIZE);
+    expr->pvt_skip_off_ = pos;
+    pos += ObBitVector::memory_size(BATCH_SIZE);
+    expr->res_buf_off_ = pos;
+    expr->res_buf_len_ = RES_BUF_LEN;
+    pos += RES_BUF_LEN * BATCH_SIZE;
+    expr->dyn_buf_header_offset_ = pos;
+    pos += sizeof(ObDynReserveBuf) * BATCH_SIZE;
+    expr->reset_datums_ptr(exec_ctx_.frames_[0], BATCH_SIZE);
+    return expr;
+  }
+
+  void set_expr(const ObExprOperatorType type, const ObObjType res_type,
+                const ObCollationType cs_type, const int64_t arg_cnt,
+                const ObExpr::EvalFunc eval_func, const ObExpr::EvalBatchFunc eval_batch_func)
+  {
+    expr_->type_ = type;
+    expr_->datum_meta_ = ObDatumMeta(res_type, cs_type, 0);
+    expr_->obj_meta_.set_type(res_type);
+    expr_->arg_cnt_ = static_cast<uint32_t>(arg_cnt);
+    expr_->eval_func_ = eval_func;
+    expr_->eval_batch_func_ = eval_batch_func;
+    for (int64_t i = 0; i < arg_cnt; i++) {
+      args_[i]->datum_meta_ = ObDatumMeta(ObVarcharType, cs_type, 0);
+      args_[i]->obj_meta_.set_type(ObVarcharType);
+    }
+  }
+
+  // fill argument datums with %vals repeatedly, NULL stands for null datum.
+  // argument is projected, no need to evaluate
+  void fill_args(const int64_t arg_idx, const char *vals[], const int64_t cnt)
+  {
+    ObExpr *arg = args_[arg_idx];
+    ObEvalInfo &info = arg->get_eval_info(*eval_ctx_);
+    info.evaluated_ = true;
+    info.projected_ = true;
+    info.notnull_ = true;
+    info.point_to_frame_ = true;
+    info.cnt_ = BATCH_SIZE;
+    ObDatum *datums = arg->locate_batch_datums(*eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      const char *str = vals[i % cnt];
+      if (NULL == str) {
+        datums[i].set_null();
+        info.notnull_ = false;
+      } else {
+        datums[i].set_string(str, static_cast<int32_t>(strlen(str)));
+      }
+    }
+  }
+
+  int eval(const ObExpr::EvalBatchFunc func, ObDatum *res)
+  {
+    int ret = OB_SUCCESS;
+    const ObExpr::EvalBatchFunc batch_func = expr_->eval_batch_func_;
+    expr_->eval_batch_func_ = func;
+    expr_->get_eval_info(*eval_ctx_).clear_evaluated_flag();
+    expr_->get_evaluated_flags(*eval_ctx_).reset(BATCH_SIZE);
+    ObDatum *datums = expr_->locate_batch_datums(*eval_ctx_);
+    if (OB_SUCC(expr_->eval_batch(*eval_ctx_, *skip_, BATCH_SIZE))) {
+      for (int64_t i = 0; i < BATCH_SIZE; i++) {
+        res[i].deep_copy(datums[i], alloc_);
+      }
+    }
+    expr_->eval_batch_func_ = batch_func;
+    return ret;
+  }
+
+  void compare(const char *name)
+  {
+    ObDatum row_res[BATCH_SIZE];
+    ObDatum batch_res[BATCH_SIZE];
+    ASSERT_EQ(OB_SUCCESS, eval(expr_default_eval_batch_func, row_res)) << name;
+    ASSERT_EQ(OB_SUCCESS, eval(expr_->eval_batch_func_, batch_res)) << name;
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      if (skip_->at(i)) {
+        continue;
+      }
+      EXPECT_TRUE(ObDatum::binary_equal(row_res[i], batch_res[i])) << name << " row " << i;
+    }
+  }
+
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx *eval_ctx_;
+  ObBitVector *skip_;
+  ObExpr *args_[MAX_ARG_CNT];
+  ObExpr *expr_;
+};
+
+// ASCII, multibyte, mixed, empty and NULL strings, some longer than RES_BUF_LEN.
+static const char *STRS[] = {
+  "Hello World", "", NULL, "ÄÖÜ straße", "MiXeD ascii и кириллица",
+  "  padded  ", "ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz 0123456789",
+  "ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏ ÐÑÒÓÔÕÖ ØÙÚÛÜÝÞ àáâãäåæçèéêëìíîï", "中文 ABC 字符串", "   ",
+  "x", "İstanbul"
+};
+
+TEST_F(TestExprStringBatch, lower_upper)
+{
+  static const ObCollationType cs_types[] = { CS_TYPE_UTF8MB4_GENERAL_CI, CS_TYPE_UTF8MB4_BIN,
+                                              CS_TYPE_BINARY };
+  for (int64_t i = 0; i < ARRAYSIZEOF(cs_types); i++) {
+    set_expr(T_FUN_SYS_LOWER, ObVarcharType, cs_types[i], 1,
+             ObExprLower::calc_lower, ObExprLower::calc_lower_batch);
+    fill_args(0, STRS, ARRAYSIZEOF(STRS));
+    compare("lower");
+    set_expr(T_FUN_SYS_UPPER, ObVarcharType, cs_types[i], 1,
+             ObExprUpper::calc_upper, ObExprUpper::calc_upper_batch);
+    fill_args(0, STRS, ARRAYSIZEOF(STRS));
+    compare("upper");
+  }
+}
+
+TEST_F(TestExprStringBatch, length)
+{
+  set_expr(T_FUN_SYS_LENGTH, ObIntType, CS_TYPE_UTF8MB4_GENERAL_CI, 1,
+           ObExprLength::calc_mysql_mode, ObExprLength::calc_mysql_mode_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  compare("length");
+}
+
+TEST_F(TestExprStringBatch, concat)
+{
+  static const char *strs2[] = { "a", "é", NULL, "", "bcd", "字", "0123456789abcdef" };
+  set_expr(T_OP_CNN, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 2,
+           ObExprConcat::eval_concat, ObExprConcat::eval_concat_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  fill_args(1, strs2, ARRAYSIZEOF(strs2));
+  compare("concat 2 args");
+
+  set_expr(T_OP_CNN, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 3,
+           ObExprConcat::eval_concat, ObExprConcat::eval_concat_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  fill_args(1, strs2, ARRAYSIZEOF(strs2));
+  fill_args(2, strs2 + 1, ARRAYSIZEOF(strs2) - 1);
+  compare("concat 3 args");
+}
+
+TEST_F(TestExprStringBatch, trim)
+{
+  static const ObExprOperatorType types[] = { T_FUN_SYS_TRIM, T_FUN_SYS_LTRIM,
+                                              T_FUN_SYS_RTRIM };
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); i++) {
+    // default ' ' pattern
+    set_expr(types[i], ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 1,
+             ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch);
+    fill_args(0, STRS, ARRAYSIZEOF(STRS));
+    compare("trim default pattern");
+  }
+  // ltrim(str, pattern) with multibyte pattern
+  static const char *patterns[] = { " ", "Ä", "中文", NULL, "  " };
+  set_expr(T_FUN_SYS_LTRIM, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 2,
+           ObExprTrim::eval_trim, ObExprTrim::eval_trim_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  fill_args(1, patterns, ARRAYSIZEOF(patterns));
+  compare("ltrim pattern");
+}
+
+TEST_F(TestExprStringBatch, replace)
+{
+  static const char *froms[] = { "l", "ä", "", NULL, "  ", "字符", "xyz" };
+  static const char *tos[] = { "LL", "", "é", "--", NULL, "ß" };
+  set_expr(T_FUN_SYS_REPLACE, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 3,
+           ObExprReplace::eval_replace, ObExprReplace::eval_replace_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  fill_args(1, froms, ARRAYSIZEOF(froms));
+  fill_args(2, tos, ARRAYSIZEOF(tos));
+  compare("replace");
+
+  set_expr(T_FUN_SYS_REPLACE, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 2,
+           ObExprReplace::eval_replace, ObExprReplace::eval_replace_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  fill_args(1, froms, ARRAYSIZEOF(froms));
+  compare("replace without to");
+}
+
+TEST_F(TestExprStringBatch, instr)
+{
+  static const char *subs[] = { "o", "straße", "", NULL, "字符", "ÖÜ", "zzz", "x" };
+  // memmem() search for binary and utf8mb4_bin, charset locate for others
+  static const ObCollationType cs_types[] = { CS_TYPE_UTF8MB4_BIN, CS_TYPE_BINARY,
+                                              CS_TYPE_UTF8MB4_GENERAL_CI };
+  for (int64_t i = 0; i < ARRAYSIZEOF(cs_types); i++) {
+    set_expr(T_FUN_SYS_INSTR, ObIntType, cs_types[i], 2,
+             ObExprInstr::calc_mysql_instr_expr, ObExprInstr::calc_mysql_instr_expr_batch);
+    fill_args(0, STRS, ARRAYSIZEOF(STRS));
+    fill_args(1, subs, ARRAYSIZEOF(subs));
+    compare("instr");
+  }
+}
+
+TEST_F(TestExprStringBatch, skip_rows)
+{
+  set_expr(T_FUN_SYS_LOWER, ObVarcharType, CS_TYPE_UTF8MB4_GENERAL_CI, 1,
+           ObExprLower::calc_lower, ObExprLower::calc_lower_batch);
+  fill_args(0, STRS, ARRAYSIZEOF(STRS));
+  for (int64_t i = 0; i < BATCH_SIZE; i += 3) {
+    skip_->set(i);
+  }
+  compare("lower with skip");
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_expr_string_batch.log", true);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr_regexp_context.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+// Check the literal extracted by ObExprRegexContext::extract_must_literal() and that
+// prefiltering by it never changes the match result.
+class TestRegexpMustLiteral : public ::testing::Test
+{
+public:
+  static const int DEFAULT_CFLAGS = OB_REG_EXTENDED | OB_REG_NOSUB;
+  static const int ICASE_CFLAGS = OB_REG_EXTENDED | OB_REG_NOSUB | OB_REG_ICASE;
+
+  TestRegexpMustLiteral() : alloc_(ObModIds::TEST) {}
+
+  virtual void TearDown() override
+  {
+    ctx_.destroy();
+    alloc_.reset();
+  }
+
+  int init(const char *pattern, const int cflags = DEFAULT_CFLAGS)
+  {
+    ctx_.destroy();
+    return ctx_.init(ObString::make_string(pattern), cflags, alloc_, false);
+  }
+
+  ObString literal() const { return ctx_.must_literal_; }
+
+  bool match(const char *text)
+  {
+    bool is_match = false;
+    EXPECT_EQ(OB_SUCCESS, ctx_.match(ObString::make_string(text), 0, is_match, alloc_));
+    return is_match;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExprRegexContext ctx_;
+};
+
+#define EXPECT_LITERAL(pattern, cflags, expect)                     \
+  do {                                                              \
+    ASSERT_EQ(OB_SUCCESS, init(pattern, cflags));                   \
+    EXPECT_EQ(ObString::make_string(expect), literal()) << pattern; \
+  } while (0)
+
+TEST_F(TestRegexpMustLiteral, plain)
+{
+  EXPECT_LITERAL("hello", DEFAULT_CFLAGS, "hello");
+  EXPECT_LITERAL("^abc$", DEFAULT_CFLAGS, "abc");
+  EXPECT_LITERAL("a.bcd", DEFAULT_CFLAGS, "bcd");
+  EXPECT_LITERAL("ab+", DEFAULT_CFLAGS, "ab");
+  EXPECT_TRUE(match("say hello"));
+  EXPECT_FALSE(match("say hell"));
+}
+
+TEST_F(TestRegexpMustLiteral, alternation)
+{
+  EXPECT_LITERAL("a|b", DEFAULT_CFLAGS, "");
+  EXPECT_LITERAL("xyz(ab|cd)", DEFAULT_CFLAGS, "");
+  EXPECT_LITERAL("abc|def", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match("def"));
+  EXPECT_FALSE(match("xyz"));
+}
+
+TEST_F(TestRegexpMustLiteral, quantifier)
+{
+  // the quantifier only weakens the character before it
+  EXPECT_LITERAL("ab?c", DEFAULT_CFLAGS, "a");
+  EXPECT_TRUE(match("ac"));
+  EXPECT_TRUE(match("abc"));
+  EXPECT_FALSE(match("bc"));
+
+  EXPECT_LITERAL("xab?cde", DEFAULT_CFLAGS, "cde");
+  EXPECT_TRUE(match("xacde"));
+  EXPECT_FALSE(match("xabcd"));
+
+  EXPECT_LITERAL("a*", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match(""));
+  EXPECT_TRUE(match("bbb"));
+
+  EXPECT_LITERAL("a*bcd", DEFAULT_CFLAGS, "bcd");
+  EXPECT_LITERAL("abcd{2}e", DEFAULT_CFLAGS, "abc");
+  EXPECT_TRUE(match("abcdde"));
+  EXPECT_FALSE(match("abcde"));
+}
+
+TEST_F(TestRegexpMustLiteral, group)
+{
+  EXPECT_LITERAL("(abc)", DEFAULT_CFLAGS, "");
+  EXPECT_LITERAL("(abcdef)?xy", DEFAULT_CFLAGS, "xy");
+  EXPECT_TRUE(match("xy"));
+  EXPECT_LITERAL("(?i)abc", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match("ABC"));
+  EXPECT_LITERAL("***=a.b", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match("xa.by"));
+  EXPECT_FALSE(match("xacby"));
+}
+
+TEST_F(TestRegexpMustLiteral, escape)
+{
+  EXPECT_LITERAL("ab\\.cd", DEFAULT_CFLAGS, "ab");
+  EXPECT_TRUE(match("ab.cd"));
+  EXPECT_FALSE(match("abxcd"));
+  EXPECT_LITERAL("\\dabc", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match("1abc"));
+  // runs after the first escape are not considered
+  EXPECT_LITERAL("ab\\d+xyzw", DEFAULT_CFLAGS, "ab");
+  EXPECT_TRUE(match("ab12xyzw"));
+}
+
+TEST_F(TestRegexpMustLiteral, char_class)
+{
+  EXPECT_LITERAL("[a-z]+foo", DEFAULT_CFLAGS, "");
+  EXPECT_TRUE(match("xfoo"));
+  EXPECT_LITERAL("foo[0-9]bar", DEFAULT_CFLAGS, "foo");
+  EXPECT_TRUE(match("foo1bar"));
+  EXPECT_FALSE(match("fo1bar"));
+  EXPECT_LITERAL("ab[[:digit:]]", DEFAULT_CFLAGS, "ab");
+  EXPECT_TRUE(match("ab7"));
+}
+
+TEST_F(TestRegexpMustLiteral, case_insensitive)
+{
+  EXPECT_LITERAL("Hello", ICASE_CFLAGS, "Hello");
+  EXPECT_TRUE(ctx_.must_literal_icase_);
+  EXPECT_FALSE(ctx_.must_not_match(ObString::make_string("xxhELLOxx")));
+  EXPECT_TRUE(ctx_.must_not_match(ObString::make_string("help")));
+  EXPECT_TRUE(match("say HELLO"));
+  EXPECT_FALSE(match("say HELP"));
+
+  EXPECT_LITERAL("Hello", DEFAULT_CFLAGS, "Hello");
+  EXPECT_FALSE(ctx_.must_literal_icase_);
+  EXPECT_FALSE(match("say HELLO"));
+
+  // only ascii case folding is done by the prefilter
+  EXPECT_LITERAL("中文abc", ICASE_CFLAGS, "");
+  EXPECT_TRUE(match("中文ABC"));
+}
+
+TEST_F(TestRegexpMustLiteral, multibyte)
+{
+  EXPECT_LITERAL("中文", DEFAULT_CFLAGS, "中文");
+  EXPECT_TRUE(match("中文字"));
+  EXPECT_FALSE(match("中字"));
+  // the quantifier drops the whole last character, not its last byte
+  EXPECT_LITERAL("中文字?ab", DEFAULT_CFLAGS, "中文");
+  EXPECT_TRUE(match("中文ab"));
+  EXPECT_TRUE(match("中文字ab"));
+  EXPECT_FALSE(match("中ab"));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_regexp_must_literal.log", true);
+  return RUN_ALL_TESTS();
+}
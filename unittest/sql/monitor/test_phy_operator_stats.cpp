@@ -81,6 +81,62 @@ TEST_F(TestPhyOperatorStats, test_add)
     EXPECT_EQ(stat.rescan_times_,  (i+3) * 2);
   }
 }
+
+TEST_F(TestPhyOperatorStats, test_misestimate)
+{
+  EXPECT_FALSE(ObPhyOperatorStats::is_card_misestimated(1, 10));
+  EXPECT_FALSE(ObPhyOperatorStats::is_card_misestimated(1000, 5000));
+  EXPECT_TRUE(ObPhyOperatorStats::is_card_misestimated(1, 100000));
+  EXPECT_TRUE(ObPhyOperatorStats::is_card_misestimated(100000, 0));
+
+  ObPhyOperatorStats stats;
+  ObArenaAllocator alloc;
+  bool is_misestimated = false;
+  EXPECT_EQ(OB_SUCCESS, stats.add_op_stat(0, 100000, 0, 1, is_misestimated));
+  EXPECT_FALSE(is_misestimated);
+  EXPECT_EQ(OB_SUCCESS, stats.init(&alloc, 2));
+  EXPECT_EQ(OB_SUCCESS, stats.add_op_stat(0, 100000, 0, 1, is_misestimated));
+  EXPECT_TRUE(is_misestimated);
+  // 10 rows per scan for 10000 rescans
+  EXPECT_EQ(OB_SUCCESS, stats.add_op_stat(1, 100010, 10000, 10, is_misestimated));
+  EXPECT_FALSE(is_misestimated);
+  ObOperatorStat stat;
+  ObPhysicalPlan plan;
+  plan.stat_.execute_times_ = 1;
+  EXPECT_EQ(OB_SUCCESS, stats.get_op_stat_accumulation(&plan, 0, stat));
+  EXPECT_EQ(stat.output_rows_, 100000);
+}
+
+TEST_F(TestPhyOperatorStats, test_first_exec_rows)
+{
+  ObArenaAllocator alloc;
+  bool is_increased = false;
+  ObPhyOperatorStats stats;
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(0, 100000, is_increased));
+  EXPECT_FALSE(is_increased);
+  EXPECT_EQ(OB_SUCCESS, stats.init(&alloc, 2));
+  // the first execution is the baseline, even if it is far from the estimation
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(0, 0, is_increased));
+  EXPECT_FALSE(is_increased);
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(0, 500, is_increased));
+  EXPECT_FALSE(is_increased);
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(0, 100000, is_increased));
+  EXPECT_TRUE(is_increased);
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(1, 100000, is_increased));
+  EXPECT_FALSE(is_increased);
+  EXPECT_EQ(OB_SUCCESS, stats.check_first_exec_rows(1, 10, is_increased));
+  EXPECT_FALSE(is_increased);
+  EXPECT_EQ(OB_ERR_UNEXPECTED, stats.check_first_exec_rows(2, 10, is_increased));
+
+  // a plan regenerated for the same parameters records the large outer side as its
+  // baseline and is not expired again by the same executions
+  ObPhyOperatorStats regenerated_stats;
+  EXPECT_EQ(OB_SUCCESS, regenerated_stats.init(&alloc, 2));
+  for (int64_t i = 0; i < 10; i++) {
+    EXPECT_EQ(OB_SUCCESS, regenerated_stats.check_first_exec_rows(0, 100000 + i, is_increased));
+    EXPECT_FALSE(is_increased);
+  }
+}
 }
 }
 int main(int argc, char *argv[])
@@ -686,6 +686,92 @@ TEST_F(TestOptEstSel, histogram)
   run_test(test_file, result_file, tmp_file, 10);
 }
 
+TEST_F(TestOptEstSel, column_group_equal_sel)
+{
+  const uint64_t table_id = 1001;
+  const uint64_t pk_id = 16;
+  OptTableMetas table_metas;
+  OptTableMeta table_meta;
+  table_meta.set_table_id(table_id);
+  table_meta.set_rows(10000);
+  ASSERT_EQ(OB_SUCCESS, table_meta.pk_ids_.push_back(pk_id));
+  ASSERT_EQ(OB_SUCCESS, table_metas.get_table_metas().push_back(table_meta));
+  ObSEArray<OptEqualFilterSel, 4> filters;
+  double selectivity = 0.0;
+
+  // exponential backoff, the most selective column first
+  filters.push_back(OptEqualFilterSel(table_id, 17, 0.1));
+  filters.push_back(OptEqualFilterSel(table_id, 18, 0.01));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.01 * std::pow(0.1, 0.5), selectivity, 1e-12);
+  filters.push_back(OptEqualFilterSel(table_id, 19, 0.5));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.01 * std::pow(0.1, 0.5) * std::pow(0.5, 0.25), selectivity, 1e-12);
+
+  // columns of different tables are independent
+  filters.reuse();
+  filters.push_back(OptEqualFilterSel(table_id, 17, 0.1));
+  filters.push_back(OptEqualFilterSel(table_id + 1, 17, 0.1));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.01, selectivity, 1e-12);
+
+  // columns contain the primary key, at most one row
+  filters.reuse();
+  filters.push_back(OptEqualFilterSel(table_id, pk_id, 0.5));
+  filters.push_back(OptEqualFilterSel(table_id, 17, 0.5));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(1.0 / 10000, selectivity, 1e-12);
+  // the pk column alone is not capped
+  filters.reuse();
+  filters.push_back(OptEqualFilterSel(table_id, pk_id, 0.5));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.5, selectivity, 1e-12);
+
+  // `c1 = 1 and c1 = 2`, filters on one column are not backed off
+  filters.reuse();
+  filters.push_back(OptEqualFilterSel(table_id, 17, 0.1));
+  filters.push_back(OptEqualFilterSel(table_id, 17, 0.1));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.01, selectivity, 1e-12);
+  filters.push_back(OptEqualFilterSel(table_id, 18, 0.04));
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::get_column_group_equal_sel(table_metas, filters, selectivity));
+  EXPECT_NEAR(0.04 * std::pow(0.1, 0.5) * 0.1, selectivity, 1e-12);
+}
+
+TEST_F(TestOptEstSel, column_group_equal_sel_switch)
+{
+  double selectivity = 0;
+  ObLogPlan *logical_plan = NULL;
+  ObDMLStmt *dml_stmt = NULL;
+  // off by default, filters are independent
+  before_process("select c1 from t1 where c1 = 1 and c2 = 1", dml_stmt, logical_plan, MUTEX_MODE, true);
+  ASSERT_TRUE(NULL != dml_stmt);
+  ASSERT_TRUE(NULL != logical_plan);
+  ASSERT_FALSE(optctx_->enable_column_group_sel());
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::calculate_selectivity(logical_plan->get_basic_table_metas(),
+                                                                logical_plan->get_selectivity_ctx(),
+                                                                dml_stmt->get_condition_exprs(),
+                                                                selectivity,
+                                                                logical_plan->get_predicate_selectivities()));
+  EXPECT_NEAR(0.1 * 0.1, selectivity, 1e-12);
+  optctx_->set_enable_column_group_sel(true);
+  ASSERT_EQ(OB_SUCCESS, ObOptSelectivity::calculate_selectivity(logical_plan->get_basic_table_metas(),
+                                                                logical_plan->get_selectivity_ctx(),
+                                                                dml_stmt->get_condition_exprs(),
+                                                                selectivity,
+                                                                logical_plan->get_predicate_selectivities()));
+  // c1 is the primary key of t1
+  const OptTableMeta *t1_meta = logical_plan->get_basic_table_metas().get_table_metas().count() > 0 ?
+      &logical_plan->get_basic_table_metas().get_table_metas().at(0) : NULL;
+  ASSERT_TRUE(NULL != t1_meta);
+  EXPECT_NEAR(std::min(0.1 * std::pow(0.1, 0.5), 1.0 / std::max(t1_meta->get_rows(), 1.0)),
+              selectivity, 1e-12);
+  optctx_->set_enable_column_group_sel(false);
+  expr_factory_.destory();
+  stmt_factory_.destory();
+  log_plan_factory_.destroy();
+}
+
 } // namespace test
 
 int main(int argc, char **argv)
@@ -261,4 +261,8 @@ select interval '123123 23:23:23.123123' day (9) to second (9) R from dual;
 select interval '123123 23:23:23.123123' day(9)to second(9) R from dual;
 select interval '12 23:23:23.123123' day to second(6) R from dual;
 select interval '12 23:23:23.123123' day to second R from dual;
-select '\103hh\100hh' 'ueuoiuo';
\ No newline at end of file
+select '\103hh\100hh' 'ueuoiuo';
+insert into t1 values (1, 'a string literal longer than sixteen bytes', "another double quoted literal over 16"), (2, 'with \' escaped quote after 16 bytes ', 'exactly sixteen.');
+insert into t1 values ('0123456789abcde\\', '0123456789abcdef''0123456789abcdef', '0123456789abcdef0123456789abcde\'x');
+select /* a comment that is much longer than sixteen bytes with * stars ** inside */ 'unterminated string 0123456789abcdef
+select /* an unterminated comment spanning more than sixteen bytes *